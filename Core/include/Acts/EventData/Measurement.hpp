@@ -240,6 +240,20 @@ class Measurement {
     return m_oParameters.residual(trackPars.getParameterSet());
   }
 
+  /// @brief calculate residual with respect to given bound parameter values
+  ///
+  /// @note The residuals of bounded and cyclic parameters are corrected as
+  ///       for the residual with respect to track parameters.
+  ///
+  /// @param parameters vector with the values of all bound parameters
+  ///
+  /// @return vector with the residual parameter values (in valid range)
+  ///
+  /// @sa ParameterSet::residual
+  ParVector_t residual(const BoundVector& parameters) const {
+    return m_oParameters.residual(parameters);
+  }
+
   /// @brief equality operator
   ///
   /// @return @c true if parameter sets and associated surfaces compare equal,
@@ -261,7 +275,7 @@ class Measurement {
   }
 
   /// @projection operator
-  static Projection_t projector() { return ParSet_t::projector(); }
+  static const Projection_t& projector() { return ParSet_t::projector(); }
 
   friend std::ostream& operator<<(
       std::ostream& out, const Measurement<source_link_t, params...>& m) {
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
@@ -33,8 +36,11 @@ template <typename T, bool select>
 using ConstIf = std::conditional_t<select, const T, T>;
 /// wrapper for a dynamic Eigen type that adds support for automatic growth
 ///
+/// The capacity grows geometrically, starting at @p kMinCapacity columns, so
+/// that adding columns one by one has amortized constant cost.
+///
 /// \warning Assumes the underlying storage has a fixed number of rows
-template <typename Storage, size_t kSizeIncrement>
+template <typename Storage, size_t kMinCapacity>
 struct GrowableColumns {
   /// Make sure storage for @p n additional columns is allocated. Will update
   /// the size of the container accordingly. The indices added by this call
@@ -43,8 +49,8 @@ struct GrowableColumns {
   /// @return View into the last allocated column
   auto addCol(size_t n = 1) {
     size_t index = m_size + (n - 1);
-    while (capacity() <= index) {
-      data.conservativeResize(Eigen::NoChange, data.cols() + kSizeIncrement);
+    if (capacity() <= index) {
+      reserve(std::max({index + 1, 2 * capacity(), kMinCapacity}));
     }
     m_size = index + 1;
 
@@ -64,8 +70,27 @@ struct GrowableColumns {
   /// Return the current allocated storage capacity
   size_t capacity() const { return static_cast<size_t>(data.cols()); }
 
+  /// Read-only view of all columns in use, which are contiguous in memory.
+  Eigen::Map<const Storage> view() const {
+    return {data.data(), data.rows(), static_cast<Eigen::Index>(m_size)};
+  }
+
+  /// Make sure storage for at least @p n columns is allocated. Does not
+  /// change the size of the container.
+  /// @param n Number of columns to allocate storage for
+  void reserve(size_t n) {
+    if (capacity() < n) {
+      data.conservativeResize(Eigen::NoChange, n);
+    }
+  }
+
   size_t size() const { return m_size; }
 
+  /// Remove all columns beyond the first @p n ones. Keeps the allocated
+  /// storage for later additions.
+  /// @param n Number of columns to keep
+  void truncate(size_t n) { m_size = std::min(m_size, n); }
+
  private:
   Storage data;
   size_t m_size{0};
@@ -76,7 +101,7 @@ template <size_t Size, bool ReadOnlyMaps = true>
 struct Types {
   enum {
     Flags = Eigen::ColMajor | Eigen::AutoAlign,
-    SizeIncrement = 8,
+    MinCapacity = 8,
   };
   using Scalar = double;
   // single items
@@ -84,19 +109,47 @@ struct Types {
   using Covariance = Eigen::Matrix<Scalar, Size, Size, Flags>;
   using CoefficientsMap = Eigen::Map<ConstIf<Coefficients, ReadOnlyMaps>>;
   using CovarianceMap = Eigen::Map<ConstIf<Covariance, ReadOnlyMaps>>;
+  // read-only views of multiple items, one item per column. covariances are
+  // stored as flattened, column-major matrices.
+  using CoefficientsColumns =
+      Eigen::Map<const Eigen::Matrix<Scalar, Size, Eigen::Dynamic, Flags>>;
+  using CovarianceColumns = Eigen::Map<
+      const Eigen::Matrix<Scalar, Size * Size, Eigen::Dynamic, Flags>>;
   // storage of multiple items in flat arrays
   using StorageCoefficients =
       GrowableColumns<Eigen::Array<Scalar, Size, Eigen::Dynamic, Flags>,
-                      SizeIncrement>;
+                      MinCapacity>;
   using StorageCovariance =
       GrowableColumns<Eigen::Array<Scalar, Size * Size, Eigen::Dynamic, Flags>,
-                      SizeIncrement>;
+                      MinCapacity>;
 };
 
 struct IndexData {
-  using IndexType = uint16_t;
-
-  static constexpr IndexType kInvalid = UINT16_MAX;
+  /// The index type can be replaced by defining ACTS_MULTITRAJECTORY_INDEX_TYPE
+  /// pre-compile time, e.g. to uint16_t to reduce the memory footprint of
+  /// small trajectories. The largest value is reserved to mark invalid
+  /// indices.
+#ifdef ACTS_MULTITRAJECTORY_INDEX_TYPE
+  using IndexType = ACTS_MULTITRAJECTORY_INDEX_TYPE;
+#else
+  using IndexType = uint32_t;
+#endif
+  static_assert(std::is_unsigned_v<IndexType>,
+                "MultiTrajectory index type must be an unsigned integer");
+
+  static constexpr IndexType kInvalid = std::numeric_limits<IndexType>::max();
+
+  /// Convert a storage position to an index, which must be representable.
+  /// @param index The position in the storage
+  /// @return The position as index type
+  /// @throw std::out_of_range if @p index can not be represented
+  static IndexType checkedIndex(size_t index) {
+    if (index >= kInvalid) {
+      throw std::out_of_range(
+          "MultiTrajectory storage exceeds the range of its index type");
+    }
+    return static_cast<IndexType>(index);
+  }
 
   IndexType irefsurface = kInvalid;
   IndexType iprevious = kInvalid;
@@ -106,8 +159,8 @@ struct IndexData {
   IndexType ijacobian = kInvalid;
   IndexType iprojector = kInvalid;
 
-  double chi2;
-  double pathLength;
+  double chi2 = 0;
+  double pathLength = 0;
   TrackStateType typeFlags;
 
   IndexType iuncalibrated = kInvalid;
@@ -162,6 +215,12 @@ class TrackStateProxy {
   /// @return Immutable ref to index tuple from the parent @c MultiTrajectory
   const IndexData& data() const { return m_traj->m_index[m_istate]; }
 
+  /// Check whether the reference surface is set.
+  /// @return Whether it is set
+  bool hasReferenceSurface() const {
+    return m_traj->m_referenceSurfaces[data().irefsurface] != nullptr;
+  }
+
   /// Reference surface.
   /// @return the reference surface
   const Surface& referenceSurface() const {
@@ -425,13 +484,14 @@ class TrackStateProxy {
     traj.m_measCov.addCol();
     // shared index between meas par
     // and cov
-    dataref.icalibrated = traj.m_meas.size() - 1;
+    dataref.icalibrated = IndexData::checkedIndex(traj.m_meas.size() - 1);
 
     traj.m_sourceLinks.emplace_back();
-    dataref.icalibratedsourcelink = traj.m_sourceLinks.size() - 1;
+    dataref.icalibratedsourcelink =
+        IndexData::checkedIndex(traj.m_sourceLinks.size() - 1);
 
     traj.m_projectors.emplace_back();
-    dataref.iprojector = traj.m_projectors.size() - 1;
+    dataref.iprojector = IndexData::checkedIndex(traj.m_projectors.size() - 1);
 
     // now actually assign to the allocated entries
     setCalibrated(meas);
@@ -574,6 +634,104 @@ class MultiTrajectory {
       const TrackStatePropMask::Type& mask = TrackStatePropMask::All,
       size_t iprevious = SIZE_MAX);
 
+  /// Allocate storage for a number of track states up-front, such that
+  /// adding them does not reallocate. Which components are reserved per
+  /// track state can be controlled via @p mask, as for addTrackState().
+  /// @param nStates The total number of track states to reserve storage for
+  /// @param mask The bitmask of the components expected per track state
+  void reserve(size_t nStates,
+               const TrackStatePropMask::Type& mask = TrackStatePropMask::All);
+
+  /// Remove the track states added after the first @p nStates ones, e.g. to
+  /// discard the states of a failed fit from a shared trajectory. Allocated
+  /// storage is kept for later additions.
+  /// @param nStates The number of track states to keep
+  /// @note The components of the removed track states must have been added
+  /// after those of the kept ones, as is the case when whole tracks are
+  /// appended one after the other.
+  void truncate(size_t nStates);
+
+  /// Number of track states stored in the trajectory.
+  size_t size() const { return m_index.size(); }
+
+  /// @name Columnar views
+  ///
+  /// Read-only views into the underlying storage without copies, e.g. for
+  /// writing all track states at once. The track states reference their
+  /// components by index into these columns, see indexColumn(). The views
+  /// are invalidated when track states are added. The per track state
+  /// values are interleaved in the index data and are returned as
+  /// contiguous copies instead.
+  /// @{
+
+  /// Columnar view type of the parameters
+  using ParametersColumns =
+      typename detail_lt::Types<ParametersSize>::CoefficientsColumns;
+  /// Columnar view type of the covariances and jacobians
+  using CovarianceColumns =
+      typename detail_lt::Types<ParametersSize>::CovarianceColumns;
+  /// Columnar view type of the calibrated measurements
+  using MeasurementColumns =
+      typename detail_lt::Types<MeasurementSizeMax>::CoefficientsColumns;
+  /// Columnar view type of the calibrated measurement covariances
+  using MeasurementCovarianceColumns =
+      typename detail_lt::Types<MeasurementSizeMax>::CovarianceColumns;
+  /// Column type of a per-track-state value
+  template <typename T>
+  using StateColumn = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+  /// All predicted, filtered and smoothed parameters.
+  ParametersColumns parametersColumns() const {
+    return {m_params.view().data(), ParametersSize,
+            static_cast<Eigen::Index>(m_params.size())};
+  }
+
+  /// All covariances, with the same columns as the parameters.
+  CovarianceColumns covarianceColumns() const {
+    return {m_cov.view().data(), ParametersSize * ParametersSize,
+            static_cast<Eigen::Index>(m_cov.size())};
+  }
+
+  /// All jacobians.
+  CovarianceColumns jacobianColumns() const {
+    return {m_jac.view().data(), ParametersSize * ParametersSize,
+            static_cast<Eigen::Index>(m_jac.size())};
+  }
+
+  /// All calibrated measurements, padded to the maximum measurement size.
+  MeasurementColumns calibratedColumns() const {
+    return {m_meas.view().data(), MeasurementSizeMax,
+            static_cast<Eigen::Index>(m_meas.size())};
+  }
+
+  /// All calibrated measurement covariances, with the same columns as the
+  /// calibrated measurements.
+  MeasurementCovarianceColumns calibratedCovarianceColumns() const {
+    return {m_measCov.view().data(), MeasurementSizeMax * MeasurementSizeMax,
+            static_cast<Eigen::Index>(m_measCov.size())};
+  }
+
+  /// The chi2 values of all track states.
+  StateColumn<double> chi2Column() const {
+    return stateColumn(&detail_lt::IndexData::chi2);
+  }
+
+  /// The path lengths of all track states.
+  StateColumn<double> pathLengthColumn() const {
+    return stateColumn(&detail_lt::IndexData::pathLength);
+  }
+
+  /// Per track state indices of one component into the columns above, e.g.
+  /// @c &detail_lt::IndexData::ipredicted for the predicted parameters.
+  /// Unset components have the index @c detail_lt::IndexData::kInvalid.
+  /// @param member The index data member of the component
+  StateColumn<detail_lt::IndexData::IndexType> indexColumn(
+      detail_lt::IndexData::IndexType detail_lt::IndexData::*member) const {
+    return stateColumn(member);
+  }
+
+  /// @}
+
   /// Access a read-only point on the trajectory by index.
   /// @param istate The index to access
   /// @return Read only proxy to the stored track state
@@ -604,6 +762,16 @@ class MultiTrajectory {
   void applyBackwards(size_t iendpoint, F&& callable);
 
  private:
+  /// Contiguous copy of one member of all index data entries
+  template <typename T>
+  StateColumn<T> stateColumn(T detail_lt::IndexData::*member) const {
+    StateColumn<T> column(m_index.size());
+    for (size_t is = 0; is < m_index.size(); ++is) {
+      column[is] = m_index[is].*member;
+    }
+    return column;
+  }
+
   /// index to map track states to the corresponding
   std::vector<detail_lt::IndexData> m_index;
   typename detail_lt::Types<ParametersSize>::StorageCoefficients m_params;
@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <bitset>
 #include <cstdint>
 #include <type_traits>
@@ -167,6 +168,8 @@ inline size_t MultiTrajectory<SL>::addTrackState(
   using CovMap =
       typename detail_lt::Types<ParametersSize, false>::CovarianceMap;
 
+  using IndexData = detail_lt::IndexData;
+
   // use a TrackStateProxy to do the assignments
   m_index.emplace_back();
   detail_lt::IndexData& p = m_index.back();
@@ -176,43 +179,43 @@ inline size_t MultiTrajectory<SL>::addTrackState(
 
   // make shared ownership held by this multi trajectory
   m_referenceSurfaces.push_back(ts.referenceSurface().getSharedPtr());
-  p.irefsurface = m_referenceSurfaces.size() - 1;
+  p.irefsurface = IndexData::checkedIndex(m_referenceSurfaces.size() - 1);
 
   if (iprevious != SIZE_MAX) {
-    p.iprevious = static_cast<uint16_t>(iprevious);
+    p.iprevious = IndexData::checkedIndex(iprevious);
   }
 
   if (ts.parameter.predicted) {
     const auto& predicted = *ts.parameter.predicted;
     m_params.addCol() = predicted.parameters();
     CovMap(m_cov.addCol().data()) = *predicted.covariance();
-    p.ipredicted = m_params.size() - 1;
+    p.ipredicted = IndexData::checkedIndex(m_params.size() - 1);
   }
 
   if (ts.parameter.filtered) {
     const auto& filtered = *ts.parameter.filtered;
     m_params.addCol() = filtered.parameters();
     CovMap(m_cov.addCol().data()) = *filtered.covariance();
-    p.ifiltered = m_params.size() - 1;
+    p.ifiltered = IndexData::checkedIndex(m_params.size() - 1);
   }
 
   if (ts.parameter.smoothed) {
     const auto& smoothed = *ts.parameter.smoothed;
     m_params.addCol() = smoothed.parameters();
     CovMap(m_cov.addCol().data()) = *smoothed.covariance();
-    p.ismoothed = m_params.size() - 1;
+    p.ismoothed = IndexData::checkedIndex(m_params.size() - 1);
   }
 
   // store jacobian
   if (ts.parameter.jacobian) {
     CovMap(m_jac.addCol().data()) = *ts.parameter.jacobian;
-    p.ijacobian = m_jac.size() - 1;
+    p.ijacobian = IndexData::checkedIndex(m_jac.size() - 1);
   }
 
   // handle measurements
   if (ts.measurement.uncalibrated) {
     m_sourceLinks.push_back(*ts.measurement.uncalibrated);
-    p.iuncalibrated = m_sourceLinks.size() - 1;
+    p.iuncalibrated = IndexData::checkedIndex(m_sourceLinks.size() - 1);
   }
 
   if (ts.measurement.calibrated) {
@@ -231,62 +234,141 @@ template <typename SL>
 inline size_t MultiTrajectory<SL>::addTrackState(
     const TrackStatePropMask::Type& mask, size_t iprevious) {
   namespace PropMask = TrackStatePropMask;
+  using IndexData = detail_lt::IndexData;
 
   m_index.emplace_back();
   detail_lt::IndexData& p = m_index.back();
   size_t index = m_index.size() - 1;
 
   if (iprevious != SIZE_MAX) {
-    p.iprevious = static_cast<uint16_t>(iprevious);
+    p.iprevious = IndexData::checkedIndex(iprevious);
   }
 
   // always set, but can be null
   m_referenceSurfaces.emplace_back(nullptr);
-  p.irefsurface = m_referenceSurfaces.size() - 1;
+  p.irefsurface = IndexData::checkedIndex(m_referenceSurfaces.size() - 1);
 
   if (ACTS_CHECK_BIT(mask, PropMask::Predicted)) {
     m_params.addCol();
     m_cov.addCol();
-    p.ipredicted = m_params.size() - 1;
+    p.ipredicted = IndexData::checkedIndex(m_params.size() - 1);
   }
 
   if (ACTS_CHECK_BIT(mask, PropMask::Filtered)) {
     m_params.addCol();
     m_cov.addCol();
-    p.ifiltered = m_params.size() - 1;
+    p.ifiltered = IndexData::checkedIndex(m_params.size() - 1);
   }
 
   if (ACTS_CHECK_BIT(mask, PropMask::Smoothed)) {
     m_params.addCol();
     m_cov.addCol();
-    p.ismoothed = m_params.size() - 1;
+    p.ismoothed = IndexData::checkedIndex(m_params.size() - 1);
   }
 
   if (ACTS_CHECK_BIT(mask, PropMask::Jacobian)) {
     m_jac.addCol();
-    p.ijacobian = m_jac.size() - 1;
+    p.ijacobian = IndexData::checkedIndex(m_jac.size() - 1);
   }
 
   if (ACTS_CHECK_BIT(mask, PropMask::Uncalibrated)) {
     m_sourceLinks.emplace_back();
-    p.iuncalibrated = m_sourceLinks.size() - 1;
+    p.iuncalibrated = IndexData::checkedIndex(m_sourceLinks.size() - 1);
   }
 
   if (ACTS_CHECK_BIT(mask, PropMask::Calibrated)) {
     m_meas.addCol();
     m_measCov.addCol();
-    p.icalibrated = m_meas.size() - 1;
+    p.icalibrated = IndexData::checkedIndex(m_meas.size() - 1);
 
     m_sourceLinks.emplace_back();
-    p.icalibratedsourcelink = m_sourceLinks.size() - 1;
+    p.icalibratedsourcelink =
+        IndexData::checkedIndex(m_sourceLinks.size() - 1);
 
     m_projectors.emplace_back();
-    p.iprojector = m_projectors.size() - 1;
+    p.iprojector = IndexData::checkedIndex(m_projectors.size() - 1);
   }
 
   return index;
 }
 
+template <typename SL>
+inline void MultiTrajectory<SL>::reserve(size_t nStates,
+                                         const TrackStatePropMask::Type& mask) {
+  namespace PropMask = TrackStatePropMask;
+
+  m_index.reserve(nStates);
+  m_referenceSurfaces.reserve(nStates);
+
+  size_t nParams = 0;
+  nParams += ACTS_CHECK_BIT(mask, PropMask::Predicted) ? 1 : 0;
+  nParams += ACTS_CHECK_BIT(mask, PropMask::Filtered) ? 1 : 0;
+  nParams += ACTS_CHECK_BIT(mask, PropMask::Smoothed) ? 1 : 0;
+  m_params.reserve(nParams * nStates);
+  m_cov.reserve(nParams * nStates);
+
+  if (ACTS_CHECK_BIT(mask, PropMask::Jacobian)) {
+    m_jac.reserve(nStates);
+  }
+
+  size_t nSourceLinks = 0;
+  nSourceLinks += ACTS_CHECK_BIT(mask, PropMask::Uncalibrated) ? 1 : 0;
+  nSourceLinks += ACTS_CHECK_BIT(mask, PropMask::Calibrated) ? 1 : 0;
+  m_sourceLinks.reserve(nSourceLinks * nStates);
+
+  if (ACTS_CHECK_BIT(mask, PropMask::Calibrated)) {
+    m_meas.reserve(nStates);
+    m_measCov.reserve(nStates);
+    m_projectors.reserve(nStates);
+  }
+}
+
+template <typename SL>
+inline void MultiTrajectory<SL>::truncate(size_t nStates) {
+  using IndexData = detail_lt::IndexData;
+
+  if (nStates >= m_index.size()) {
+    return;
+  }
+
+  // The first component referenced by any removed state marks the new end
+  // of the respective column
+  size_t nParams = m_params.size();
+  size_t nJacobians = m_jac.size();
+  size_t nMeasurements = m_meas.size();
+  size_t nSourceLinks = m_sourceLinks.size();
+  size_t nProjectors = m_projectors.size();
+  size_t nSurfaces = m_referenceSurfaces.size();
+  auto keepBefore = [](size_t& n, IndexData::IndexType index) {
+    if (index != IndexData::kInvalid) {
+      n = std::min(n, static_cast<size_t>(index));
+    }
+  };
+  for (size_t istate = nStates; istate < m_index.size(); ++istate) {
+    const IndexData& data = m_index[istate];
+    keepBefore(nParams, data.ipredicted);
+    keepBefore(nParams, data.ifiltered);
+    keepBefore(nParams, data.ismoothed);
+    keepBefore(nJacobians, data.ijacobian);
+    keepBefore(nMeasurements, data.icalibrated);
+    keepBefore(nSourceLinks, data.iuncalibrated);
+    keepBefore(nSourceLinks, data.icalibratedsourcelink);
+    keepBefore(nProjectors, data.iprojector);
+    keepBefore(nSurfaces, data.irefsurface);
+  }
+
+  m_index.resize(nStates);
+  m_params.truncate(nParams);
+  m_cov.truncate(nParams);
+  m_jac.truncate(nJacobians);
+  m_meas.truncate(nMeasurements);
+  m_measCov.truncate(nMeasurements);
+  m_sourceLinks.erase(m_sourceLinks.begin() + nSourceLinks,
+                      m_sourceLinks.end());
+  m_projectors.resize(nProjectors);
+  m_referenceSurfaces.resize(nSurfaces);
+}
+
 template <typename SL>
 template <typename F>
 void MultiTrajectory<SL>::visitBackwards(size_t iendpoint, F&& callable) const {
@@ -0,0 +1,188 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+namespace Acts {
+
+/// Flat binary export of all track states of a MultiTrajectory.
+///
+/// The export is a header with a section table followed by the sections:
+/// one fixed-size StateRecord per track state, and the parameters,
+/// covariances, jacobians, calibrated measurements and their covariances
+/// as flat arrays of doubles with one item per column as in the columnar
+/// views of the MultiTrajectory. The state records reference the items by
+/// column index, hence the arrays are copied from the storage as one block
+/// each.
+///
+/// @note Source links are not exported, the measurement of a track state
+///       is identified by the GeometryID of its reference surface.
+namespace MultiTrajectoryExport {
+
+/// Identification of the export format
+constexpr char kMagic[8] = {'A', 'C', 'T', 'S', 'T', 'R', 'K', '\0'};
+constexpr uint32_t kVersion = 1;
+
+/// Marker for unset components
+constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+
+/// The sections of the export, in the order of the section table
+enum Section : uint32_t {
+  eStates = 0,
+  eParameters = 1,
+  eCovariances = 2,
+  eJacobians = 3,
+  eCalibrated = 4,
+  eCalibratedCovariances = 5,
+  eNumSections = 6
+};
+
+/// Position of a section, the count is in items (not bytes)
+struct SectionRecord {
+  uint64_t offset = 0;
+  uint64_t count = 0;
+};
+
+struct HeaderRecord {
+  char magic[8] = {};
+  uint32_t version = kVersion;
+  uint32_t nSections = eNumSections;
+  /// number of doubles per parameters and calibrated measurement item
+  uint32_t parametersSize = 0;
+  uint32_t measurementSizeMax = 0;
+  SectionRecord sections[eNumSections];
+};
+
+struct StateRecord {
+  /// GeometryID of the reference surface, 0 if not set
+  uint64_t geoID = 0;
+  /// index of the previous state, kInvalid for the first one
+  uint32_t previous = kInvalid;
+  /// column indices into the sections, kInvalid if not set
+  uint32_t predicted = kInvalid;
+  uint32_t filtered = kInvalid;
+  uint32_t smoothed = kInvalid;
+  uint32_t jacobian = kInvalid;
+  uint32_t calibrated = kInvalid;
+  uint32_t measurementSize = 0;
+  uint32_t typeFlags = 0;
+  double chi2 = 0.;
+  double pathLength = 0.;
+};
+
+namespace detail {
+/// Append a section of trivially copyable items to the buffer
+template <typename value_t>
+void append(std::vector<char>& buffer, SectionRecord& section,
+            const value_t* values, size_t count, size_t width = 1) {
+  static_assert(std::is_trivially_copyable<value_t>::value,
+                "Items need to be trivially copyable");
+  section.offset = buffer.size();
+  section.count = count;
+  size_t bytes = count * width * sizeof(value_t);
+  buffer.resize(buffer.size() + bytes);
+  if (bytes > 0) {
+    std::memcpy(buffer.data() + section.offset, values, bytes);
+  }
+}
+
+/// Convert a MultiTrajectory index into an exported index
+inline uint32_t exportIndex(detail_lt::IndexData::IndexType index) {
+  return index == detail_lt::IndexData::kInvalid ? kInvalid
+                                                 : static_cast<uint32_t>(index);
+}
+}  // namespace detail
+
+/// Write all track states of a trajectory
+///
+/// @tparam source_link_t Type of the source links
+/// @param trajectory The trajectory to export
+///
+/// @return the binary export
+template <typename source_link_t>
+std::vector<char> write(const MultiTrajectory<source_link_t>& trajectory) {
+  using Trajectory = MultiTrajectory<source_link_t>;
+  using IndexData = detail_lt::IndexData;
+  constexpr size_t nPars = Trajectory::ParametersSize;
+  constexpr size_t nMeas = Trajectory::MeasurementSizeMax;
+
+  // the only per-state work: collect the indices and values of each state
+  std::vector<StateRecord> states(trajectory.size());
+  auto previous = trajectory.indexColumn(&IndexData::iprevious);
+  auto predicted = trajectory.indexColumn(&IndexData::ipredicted);
+  auto filtered = trajectory.indexColumn(&IndexData::ifiltered);
+  auto smoothed = trajectory.indexColumn(&IndexData::ismoothed);
+  auto jacobian = trajectory.indexColumn(&IndexData::ijacobian);
+  auto calibrated = trajectory.indexColumn(&IndexData::icalibrated);
+  auto measdim = trajectory.indexColumn(&IndexData::measdim);
+  auto chi2 = trajectory.chi2Column();
+  auto pathLength = trajectory.pathLengthColumn();
+  for (size_t is = 0; is < states.size(); ++is) {
+    StateRecord& record = states[is];
+    auto ts = trajectory.getTrackState(is);
+    if (ts.hasReferenceSurface()) {
+      record.geoID = ts.referenceSurface().geoID().value();
+    }
+    record.previous = detail::exportIndex(previous[is]);
+    record.predicted = detail::exportIndex(predicted[is]);
+    record.filtered = detail::exportIndex(filtered[is]);
+    record.smoothed = detail::exportIndex(smoothed[is]);
+    record.jacobian = detail::exportIndex(jacobian[is]);
+    record.calibrated = detail::exportIndex(calibrated[is]);
+    record.measurementSize = measdim[is];
+    record.typeFlags = ts.typeFlags().to_ulong();
+    record.chi2 = chi2[is];
+    record.pathLength = pathLength[is];
+  }
+
+  HeaderRecord header;
+  std::copy(std::begin(kMagic), std::end(kMagic), header.magic);
+  header.parametersSize = nPars;
+  header.measurementSizeMax = nMeas;
+
+  // the numeric content is copied as one block per section
+  auto params = trajectory.parametersColumns();
+  auto cov = trajectory.covarianceColumns();
+  auto jac = trajectory.jacobianColumns();
+  auto meas = trajectory.calibratedColumns();
+  auto measCov = trajectory.calibratedCovarianceColumns();
+  size_t nDoubles = params.size() + cov.size() + jac.size() + meas.size() +
+                    measCov.size();
+  std::vector<char> buffer;
+  buffer.reserve(sizeof(HeaderRecord) + states.size() * sizeof(StateRecord) +
+                 nDoubles * sizeof(double));
+  buffer.resize(sizeof(HeaderRecord));
+  auto& sections = header.sections;
+  detail::append(buffer, sections[eStates], states.data(), states.size());
+  detail::append(buffer, sections[eParameters], params.data(), params.cols(),
+                 nPars);
+  detail::append(buffer, sections[eCovariances], cov.data(), cov.cols(),
+                 nPars * nPars);
+  detail::append(buffer, sections[eJacobians], jac.data(), jac.cols(),
+                 nPars * nPars);
+  detail::append(buffer, sections[eCalibrated], meas.data(), meas.cols(),
+                 nMeas);
+  detail::append(buffer, sections[eCalibratedCovariances], measCov.data(),
+                 measCov.cols(), nMeas * nMeas);
+  std::memcpy(buffer.data(), &header, sizeof(HeaderRecord));
+  return buffer;
+}
+
+}  // namespace MultiTrajectoryExport
+}  // namespace Acts
@@ -8,6 +8,7 @@
 
 #pragma once
 // STL include(s)
+#include <array>
 #include <memory>
 #include <optional>
 #include <type_traits>
@@ -107,6 +108,12 @@ class ParameterSet {
   using ParVector_t = ActsVector<ParValue_t, NPars>;
   /// type of covariance matrix
   using CovMatrix_t = ActsSymMatrix<ParValue_t, NPars>;
+  /// vector type for the full set of bound parameters
+  using FullParVector_t = ActsVector<ParValue_t, eBoundParametersSize>;
+
+  /// indices of the stored parameters in the full parameter vector
+  static constexpr std::array<unsigned int, sizeof...(params)> indices{
+      static_cast<unsigned int>(params)...};
 
   /**
    * @brief initialize values of stored parameters and their covariance matrix
@@ -411,7 +418,27 @@ class ParameterSet {
    *         which are also defined for this ParameterSet object
    */
   ParVector_t project(const FullParameterSet& fullParSet) const {
-    return projector() * fullParSet.getParameters();
+    return project(fullParSet.getParameters());
+  }
+
+  /**
+   * @brief project vector of full parameter values onto parameters of this
+   * ParameterSet object
+   *
+   * The values are gathered with the parameter indices, which is equivalent
+   * to, but cheaper than, the multiplication with the projection matrix.
+   *
+   * @param fullParValues vector containing values for all defined parameters
+   *
+   * @return vector containing only the parameter values which are also
+   * defined for this ParameterSet object
+   */
+  static ParVector_t project(const FullParVector_t& fullParValues) {
+    ParVector_t values;
+    for (unsigned int i = 0; i < NPars; ++i) {
+      values(i) = fullParValues(indices[i]);
+    }
+    return values;
   }
 
   /**
@@ -454,8 +481,26 @@ class ParameterSet {
       std::enable_if_t<not std::is_same<T, FullParameterSet>::value, int> = 0>
   /// @endcond
   ParVector_t residual(const FullParameterSet& fullParSet) const {
-    return detail::residual_calculator<params...>::result(
-        m_vValues, projector() * fullParSet.getParameters());
+    return residual(fullParSet.getParameters());
+  }
+
+  /**
+   * @brief calculate residual difference to full parameter vector
+   *
+   * Same as the residual to a full ParameterSet object, but taking the
+   * parameter values only. The values are gathered with the parameter
+   * indices and corrected for bounded and cyclic parameters in a single
+   * pass.
+   *
+   * @param fullParValues vector containing values for all defined parameters
+   *
+   * @return vector containing the residual parameter values of this
+   * ParameterSet object
+   *         with respect to the given full parameter vector
+   */
+  ParVector_t residual(const FullParVector_t& fullParValues) const {
+    return detail::residual_calculator<params...>::result(m_vValues,
+                                                          fullParValues);
   }
 
   /**
@@ -505,9 +550,7 @@ class ParameterSet {
    * @return constant matrix with @c #NPars rows and @c
    * #Acts::eBoundParametersSize columns
    */
-  static const ActsMatrix<ParValue_t, NPars, eBoundParametersSize> projector() {
-    return sProjector;
-  }
+  static const Projection_t& projector() { return sProjector; }
 
   /**
    * @brief number of stored parameters
@@ -546,6 +589,10 @@ class ParameterSet {
 template <ParID_t... params>
 constexpr unsigned int ParameterSet<params...>::NPars;
 
+template <ParID_t... params>
+constexpr std::array<unsigned int, sizeof...(params)>
+    ParameterSet<params...>::indices;
+
 template <ParID_t... params>
 const typename ParameterSet<params...>::Projection_t
     ParameterSet<params...>::sProjector = detail::make_projection_matrix<
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2019 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -27,37 +27,15 @@ namespace detail {
 /// @return make_projection_matrix<columns,rows...>::init() returns a matrix
 ///         with dimensions (`sizeof...(rows)` x columns)
 template <unsigned int columns, unsigned int... rows>
-struct make_projection_matrix;
-
-/// @cond
-// build projection matrix by iteratively stacking row vectors
-template <unsigned int columns, unsigned int i, unsigned int... N>
-struct make_projection_matrix<columns, i, N...> {
-  static ActsMatrixD<sizeof...(N) + 1, columns> init() {
-    ActsRowVectorD<columns> v;
-    v.setZero();
-    v(i) = 1;
-
-    ActsMatrixD<sizeof...(N) + 1, columns> m;
-    m.row(0) << v;
-    m.block(1, 0, sizeof...(N), columns)
-        << make_projection_matrix<columns, N...>::init();
-
+struct make_projection_matrix {
+  static ActsMatrixD<sizeof...(rows), columns> init() {
+    ActsMatrixD<sizeof...(rows), columns> m;
+    m.setZero();
+    unsigned int row = 0;
+    ((m(row++, rows) = 1), ...);
     return m;
   }
 };
-
-// projection matrix for a single local parameter is a simple row vector
-template <unsigned int columns, unsigned int i>
-struct make_projection_matrix<columns, i> {
-  static ActsRowVectorD<columns> init() {
-    ActsRowVectorD<columns> v;
-    v.setZero();
-    v(i) = 1;
-    return v;
-  }
-};
-/// @endcond
 }  // namespace detail
 /// @endcond
 }  // namespace Acts
\ No newline at end of file
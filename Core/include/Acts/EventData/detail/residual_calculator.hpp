@@ -1,12 +1,14 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2019 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
+#include <utility>
+
 // Acts include(s)
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
@@ -22,45 +24,57 @@ namespace detail {
 /// Calculate the difference between the two given vectors with parameter
 /// values. Possible corrections for bounded or cyclic parameters are applied.
 ///
+/// The reference values are either given for the same parameters or as a
+/// full bound parameter vector, from which they are gathered with the
+/// parameter identifiers as indices, i.e. without a projection matrix. The
+/// corrections are resolved per parameter at compile time and applied in
+/// the same pass as the difference. If none of the parameters needs a
+/// correction, the residual is a plain vector difference.
+///
 /// @return residual_calculator<params...>::result(first,second) yields the
 ///         residuals of `first` with respect to `second`
-template <ParID_t... params>
-struct residual_calculator;
-
-/// @cond
-template <typename R, ParID_t... params>
-struct residual_calculator_impl;
-
 template <ParID_t... params>
 struct residual_calculator {
   using ParVector_t = ActsVector<ParValue_t, sizeof...(params)>;
+  using FullParVector_t = ActsVector<ParValue_t, eBoundParametersSize>;
+
+  /// whether any of the parameters is bounded or cyclic
+  static constexpr bool may_modify_value =
+      (BoundParameterType<params>::may_modify_value or ...);
 
   static ParVector_t result(const ParVector_t& test, const ParVector_t& ref) {
-    ParVector_t result;
-    residual_calculator_impl<ParVector_t, params...>::calculate(result, test,
-                                                                ref, 0);
-    return result;
+    if constexpr (not may_modify_value) {
+      return test - ref;
+    } else {
+      return calculate(test, ref,
+                       std::make_index_sequence<sizeof...(params)>());
+    }
   }
-};
 
-template <typename R, ParID_t first, ParID_t... others>
-struct residual_calculator_impl<R, first, others...> {
-  static void calculate(R& result, const R& test, const R& ref,
-                        unsigned int pos) {
-    result(pos) = BoundParameterType<first>::getDifference(test(pos), ref(pos));
-    residual_calculator_impl<R, others...>::calculate(result, test, ref,
-                                                      pos + 1);
+  /// @cond
+  template <
+      typename T = ParVector_t,
+      std::enable_if_t<not std::is_same<T, FullParVector_t>::value, int> = 0>
+  /// @endcond
+  static ParVector_t result(const ParVector_t& test,
+                            const FullParVector_t& full) {
+    return calculate(test, full, std::make_index_sequence<sizeof...(params)>());
   }
-};
 
-template <typename R, ParID_t last>
-struct residual_calculator_impl<R, last> {
-  static void calculate(R& result, const R& test, const R& ref,
-                        unsigned int pos) {
-    result(pos) = BoundParameterType<last>::getDifference(test(pos), ref(pos));
+ private:
+  template <typename ref_t, size_t... pos>
+  static ParVector_t calculate(const ParVector_t& test, const ref_t& ref,
+                               std::index_sequence<pos...> /*unused*/) {
+    // the reference values are read at the parameter index for a full
+    // vector and at the position in the parameter pack otherwise
+    constexpr bool kFull = ref_t::RowsAtCompileTime != sizeof...(params);
+    ParVector_t result;
+    ((result(pos) = BoundParameterType<params>::getDifference(
+          test(pos), ref(kFull ? static_cast<unsigned int>(params) : pos))),
+     ...);
+    return result;
   }
 };
-/// @endcond
 }  // namespace detail
 /// @endcond
 }  // namespace Acts
@@ -1,12 +1,14 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2016-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2016-2019 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
+#include <utility>
+
 // Acts include(s)
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
@@ -29,43 +31,29 @@ namespace detail {
 ///
 /// @post All values in the argument `parVector` are within the valid
 ///       parameter range.
-template <ParID_t... params>
-struct value_corrector;
-
-/// @cond
-template <typename R, ParID_t... params>
-struct value_corrector_impl;
-
 template <ParID_t... params>
 struct value_corrector {
   using ParVector_t = ActsVector<ParValue_t, sizeof...(params)>;
 
   static void result(ParVector_t& values) {
-    value_corrector_impl<ParVector_t, params...>::calculate(values, 0);
+    calculate(values, std::make_index_sequence<sizeof...(params)>());
   }
-};
 
-template <typename R, ParID_t first, ParID_t... others>
-struct value_corrector_impl<R, first, others...> {
-  static void calculate(R& values, unsigned int pos) {
-    using parameter_type = BoundParameterType<first>;
-    if (parameter_type::may_modify_value) {
-      values(pos) = parameter_type::getValue(values(pos));
-    }
-    value_corrector_impl<R, others...>::calculate(values, pos + 1);
+ private:
+  template <size_t... pos>
+  static void calculate(ParVector_t& values,
+                        std::index_sequence<pos...> /*unused*/) {
+    // parameters which can not be out of range are skipped at compile time
+    (correct<params>(values(pos)), ...);
   }
-};
 
-template <typename R, ParID_t last>
-struct value_corrector_impl<R, last> {
-  static void calculate(R& values, unsigned int pos) {
-    using parameter_type = BoundParameterType<last>;
-    if (parameter_type::may_modify_value) {
-      values(pos) = parameter_type::getValue(values(pos));
+  template <ParID_t par>
+  static void correct(ParValue_t& value) {
+    if constexpr (BoundParameterType<par>::may_modify_value) {
+      value = BoundParameterType<par>::getValue(value);
     }
   }
 };
-/// @endcond
 }  // namespace detail
 /// @endcond
 }  // namespace Acts
@@ -0,0 +1,32 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Fitter/GainMatrixSmoother.hpp"
+#include "Acts/Fitter/detail/SmoothingGain.hpp"
+
+namespace Acts {
+
+/// @brief Kalman smoother based on the gain matrix formalism, which solves
+/// for the smoothing gain instead of inverting the predicted covariance
+///
+/// The smoothing gain @f$ G_k = F_k J_{k+1}^T P_{k+1}^{-1} @f$ is obtained
+/// from the linear system @f$ P_{k+1} G_k^T = J_{k+1} F_k @f$ through a
+/// Cholesky decomposition of the predicted covariance, see
+/// detail::CholeskySmoothingGain. The recursion is the one of the
+/// GainMatrixSmoother, hence this is a drop-in replacement for it as the
+/// smoother of the @c KalmanFitter.
+///
+/// @tparam parameters_t Type of the track parameters
+template <typename parameters_t>
+using CholeskySmoother = GainMatrixSmoother<
+    parameters_t,
+    detail::CholeskySmoothingGain<typename parameters_t::CovMatrix_t>>;
+
+}  // namespace Acts
@@ -0,0 +1,750 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/EventData/TrackState.hpp"
+#include "Acts/Fitter/KalmanFitterError.hpp"
+#include "Acts/Fitter/detail/SourceLinkLookup.hpp"
+#include "Acts/Fitter/detail/VoidKalmanComponents.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
+#include "Acts/Propagator/detail/StandardAborters.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Options struct how the combinatorial Kalman filter is called
+///
+/// It contains the context of the track finding call, the criteria for the
+/// selection of the measurement candidates and the pruning of the branches,
+/// and configurations for material effects.
+///
+/// @note the context objects must be provided
+struct CombinatorialKalmanFilterOptions {
+  /// Deleted default constructor
+  CombinatorialKalmanFilterOptions() = delete;
+
+  /// PropagatorOptions with context
+  ///
+  /// @param gctx The goemetry context for this track finding
+  /// @param mctx The magnetic context for this track finding
+  /// @param cctx The calibration context for this track finding
+  /// @param mScattering Whether to include multiple scattering
+  /// @param eLoss Whether to include energy loss
+  CombinatorialKalmanFilterOptions(
+      std::reference_wrapper<const GeometryContext> gctx,
+      std::reference_wrapper<const MagneticFieldContext> mctx,
+      std::reference_wrapper<const CalibrationContext> cctx,
+      bool mScattering = true, bool eLoss = true)
+      : geoContext(gctx),
+        magFieldContext(mctx),
+        calibrationContext(cctx),
+        multipleScattering(mScattering),
+        energyLoss(eLoss) {}
+
+  /// Context object for the geometry
+  std::reference_wrapper<const GeometryContext> geoContext;
+  /// Context object for the magnetic field
+  std::reference_wrapper<const MagneticFieldContext> magFieldContext;
+  /// context object for the calibration
+  std::reference_wrapper<const CalibrationContext> calibrationContext;
+
+  /// Maximum chi2 of a measurement with respect to the predicted parameters
+  /// to be considered as a candidate
+  double maxChi2 = 15.;
+
+  /// Maximum number of candidates on a surface, each of them starts a branch
+  size_t maxBranchesPerSurface = 3;
+
+  /// Maximum number of branches, i.e. found and pending track candidates
+  size_t maxBranches = 100;
+
+  /// Maximum number of sensitive surfaces without measurement on a branch
+  size_t maxHoles = 2;
+
+  /// Minimum number of measurements of a found track candidate
+  size_t minMeasurements = 3;
+
+  /// Maximum number of propagation steps for all branches together
+  unsigned int maxSteps = 10000;
+
+  /// Maximum path length of each branch, from the start or from the track
+  /// state where it is resumed. It is also limited by the loop protection.
+  double pathLimit = std::numeric_limits<double>::max();
+
+  /// Whether to consider multiple scattering
+  bool multipleScattering = true;
+
+  /// Whether to consider energy loss
+  bool energyLoss = true;
+};
+
+template <typename source_link_t>
+struct CombinatorialKalmanFilterResult {
+  /// A track candidate that is being followed
+  struct Branch {
+    // Index of the last track state of the branch
+    size_t tip = SIZE_MAX;
+    // Index of the last track state with a measurement
+    size_t lastMeasurement = SIZE_MAX;
+    // Number of track states with a measurement
+    size_t nMeasurements = 0;
+    // Number of sensitive surfaces without measurement
+    size_t nHoles = 0;
+  };
+
+  // The track states of all branches. Branches starting on the same surface
+  // share all previous track states, which are stored only once.
+  MultiTrajectory<source_link_t> fittedStates;
+
+  // The indices of the last measurement state of each found track candidate,
+  // ordered by the depth-first search, i.e. the candidate built from the best
+  // measurement on each surface comes first.
+  std::vector<size_t> trackTips;
+
+  // The branch that is currently followed by the propagation
+  Branch currentBranch;
+
+  // The branches that are still to be followed
+  std::vector<Branch> activeBranches;
+
+  // Indicator if initialization has been performed.
+  bool initialized = false;
+
+  // Indicator if all branches have been followed
+  bool finished = false;
+
+  Result<void> result{Result<void>::success()};
+};
+
+/// @brief Combinatorial Kalman filter for track finding as a plugin to the
+/// Propagator
+///
+/// @tparam propagator_t Type of the propagation class
+/// @tparam updater_t Type of the kalman updater class
+/// @tparam calibrator_t Type of the calibrator class
+///
+/// In contrast to the KalmanFitter, which follows one measurement per surface
+/// assigned beforehand, the track finding considers all measurements on each
+/// sensitive surface that it reaches. The measurements compatible with the
+/// predicted parameters are each filtered into a new track state, and every
+/// one of them starts a branch of the track. The branches are stored in one
+/// MultiTrajectory, where the track states before the branching point are
+/// shared by all branches, i.e. no history is copied.
+///
+/// The branches are followed depth-first, starting with the best candidate:
+/// once a branch ends, i.e. the end of the world or the maximum number of
+/// holes is reached, the propagation is restarted from the last track state
+/// of the next pending branch. Branches are pruned by the number of
+/// candidates per surface, the number of holes and the total number of
+/// branches.
+///
+/// The found track candidates are filtered but not smoothed, since the
+/// shared track states belong to several candidates. They are meant to be
+/// refitted, e.g. with the KalmanFitter.
+template <typename propagator_t, typename updater_t = VoidKalmanUpdater,
+          typename calibrator_t = VoidMeasurementCalibrator>
+class CombinatorialKalmanFilter {
+ public:
+  /// Default constructor is deleted
+  CombinatorialKalmanFilter() = delete;
+
+  /// Constructor from arguments
+  CombinatorialKalmanFilter(propagator_t pPropagator,
+                            std::unique_ptr<const Logger> logger =
+                                getDefaultLogger("CombinatorialKalmanFilter",
+                                                 Logging::INFO))
+      : m_propagator(std::move(pPropagator)), m_logger(logger.release()) {}
+
+ private:
+  /// The propgator for the transport and material update
+  propagator_t m_propagator;
+
+  /// Logger getter to support macros
+  const Logger& logger() const { return *m_logger; }
+
+  /// Owned logging instance
+  std::shared_ptr<const Logger> m_logger;
+
+  /// @brief Propagator Actor plugin for the CombinatorialKalmanFilter
+  ///
+  /// @tparam source_link_t is an type fulfilling the @c SourceLinkConcept
+  template <typename source_link_t>
+  class Actor {
+   public:
+    /// Broadcast the result_type
+    using result_type = CombinatorialKalmanFilterResult<source_link_t>;
+    using Branch = typename result_type::Branch;
+
+    /// Allows retrieving the candidate measurements on a surface
+    detail::SourceLinkLookup<source_link_t> inputMeasurements;
+
+    /// The track finding options without the contexts
+    double maxChi2 = 15.;
+    size_t maxBranchesPerSurface = 3;
+    size_t maxBranches = 100;
+    size_t maxHoles = 2;
+    size_t minMeasurements = 3;
+    bool multipleScattering = true;
+    bool energyLoss = true;
+
+    /// @brief Combinatorial Kalman filter actor operation
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param state is the mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result is the mutable result state object
+    template <typename propagator_state_t, typename stepper_t>
+    void operator()(propagator_state_t& state, const stepper_t& stepper,
+                    result_type& result) const {
+      if (result.finished) {
+        return;
+      }
+      ACTS_VERBOSE("CombinatorialKalmanFilter step");
+
+      if (!result.initialized) {
+        ACTS_VERBOSE("Initializing");
+        result.initialized = true;
+      }
+
+      // Update:
+      // - Waiting for a current surface
+      // - The surface of a resumed branch is already handled
+      auto surface = state.navigation.currentSurface;
+      if (surface != nullptr and not onBranchTip(surface, result)) {
+        auto res = filter(surface, state, stepper, result);
+        if (!res.ok()) {
+          ACTS_ERROR("Error in filter: " << res.error());
+          result.result = res.error();
+          result.finished = true;
+          return;
+        }
+      }
+
+      // End of the current branch: continue with the next pending one. The
+      // path limit, e.g. from the loop protection, applies to each branch.
+      if (state.navigation.navigationBreak or state.navigation.targetReached or
+          pathLimitReached(state) or result.currentBranch.nHoles > maxHoles) {
+        finishBranch(result);
+        if (result.activeBranches.empty()) {
+          ACTS_VERBOSE("All branches are followed");
+          result.finished = true;
+        } else {
+          resume(state, stepper, result);
+        }
+      }
+    }
+
+    /// @brief Check if the current branch reached the path limit
+    ///
+    /// This is the condition of the path aborter of the propagation, which
+    /// would otherwise stop the propagation of all branches.
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    ///
+    /// @param state is the propagator state object
+    template <typename propagator_state_t>
+    bool pathLimitReached(const propagator_state_t& state) const {
+      const auto& pathAborter =
+          state.options.abortList.template get<detail::PathLimitReached>();
+      const double distance =
+          state.stepping.navDir * std::abs(pathAborter.internalLimit) -
+          state.stepping.pathAccumulated;
+      const double tolerance = state.options.targetTolerance;
+      return distance * distance < tolerance * tolerance;
+    }
+
+    /// @brief Check if the surface holds the last track state of the branch
+    ///
+    /// @param surface The current surface
+    /// @param result is the result state object
+    bool onBranchTip(const Surface* surface, const result_type& result) const {
+      const size_t tip = result.currentBranch.tip;
+      return tip != SIZE_MAX and
+             &result.fittedStates.getTrackState(tip).referenceSurface() ==
+                 surface;
+    }
+
+    /// @brief Combinatorial Kalman filter actor operation : finish branch
+    ///
+    /// @param result is the mutable result state object
+    void finishBranch(result_type& result) const {
+      const Branch& branch = result.currentBranch;
+      ACTS_VERBOSE("Branch ends with " << branch.nMeasurements
+                                       << " measurements and "
+                                       << branch.nHoles << " holes");
+      if (branch.nMeasurements >= minMeasurements) {
+        result.trackTips.push_back(branch.lastMeasurement);
+      }
+    }
+
+    /// @brief Combinatorial Kalman filter actor operation : resume branch
+    ///
+    /// Resets the navigation and stepping to the last track state of the
+    /// next pending branch.
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param state is the mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result is the mutable result state object
+    template <typename propagator_state_t, typename stepper_t>
+    void resume(propagator_state_t& state, const stepper_t& stepper,
+                result_type& result) const {
+      result.currentBranch = result.activeBranches.back();
+      result.activeBranches.pop_back();
+      auto st = result.fittedStates.getTrackState(result.currentBranch.tip);
+      ACTS_VERBOSE("Resume branch at track state " << result.currentBranch.tip
+                                                   << " on surface "
+                                                   << st.referenceSurface()
+                                                          .geoID());
+
+      auto filtered = st.filteredParameters(state.options.geoContext);
+
+      // Reset the navigation state to the surface of the track state, the
+      // volume is searched by position if the surface has no associated layer
+      auto worldVolume = state.navigation.worldVolume;
+      state.navigation = typename propagator_t::NavigatorState();
+      state.navigation.worldVolume = worldVolume;
+      state.navigation.startSurface = &st.referenceSurface();
+      state.navigation.startLayer =
+          state.navigation.startSurface->associatedLayer();
+      if (state.navigation.startLayer != nullptr) {
+        state.navigation.startVolume =
+            state.navigation.startLayer->trackingVolume();
+      } else if (worldVolume != nullptr) {
+        state.navigation.startVolume = worldVolume->lowestTrackingVolume(
+            state.options.geoContext, filtered.position());
+        state.navigation.startLayer =
+            (state.navigation.startVolume != nullptr)
+                ? state.navigation.startVolume->associatedLayer(
+                      state.options.geoContext, filtered.position())
+                : nullptr;
+      }
+      state.navigation.currentSurface = state.navigation.startSurface;
+      state.navigation.currentVolume = state.navigation.startVolume;
+
+      // Update the stepping state with the filtered parameters
+      stepper.update(state.stepping, filtered);
+      state.stepping.stepSize = ConstrainedStep(state.options.maxStepSize);
+      state.stepping.pathAccumulated = 0.;
+      // Reinitialize the stepping jacobian
+      st.referenceSurface().initJacobianToGlobal(
+          state.options.geoContext, state.stepping.jacToGlobal,
+          state.stepping.pos, state.stepping.dir, filtered.parameters());
+      state.stepping.jacobian = BoundMatrix::Identity();
+      state.stepping.jacTransport = FreeMatrix::Identity();
+      state.stepping.derivative = FreeVector::Zero();
+
+      // The material after the measurement has not been applied yet
+      materialInteractor(state.navigation.currentSurface, state, stepper,
+                         postUpdate);
+    }
+
+    /// @brief Combinatorial Kalman filter actor operation : update
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param surface The surface where the update happens
+    /// @param state The mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result The mutable result state object
+    template <typename propagator_state_t, typename stepper_t>
+    Result<void> filter(const Surface* surface, propagator_state_t& state,
+                        const stepper_t& stepper, result_type& result) const {
+      auto candidates = inputMeasurements.findAll(surface);
+      if (candidates.empty()) {
+        addHoleOrMaterialState(surface, state, stepper, result, fullUpdate);
+        return Result<void>::success();
+      }
+      ACTS_VERBOSE("Measurement surface " << surface->geoID() << " with "
+                                          << candidates.size()
+                                          << " candidates detected.");
+
+      // Update state and stepper with pre material effects
+      materialInteractor(surface, state, stepper, preUpdate);
+
+      // Transport & bind the state to the current surface
+      auto [boundParams, jacobian, pathLength] =
+          stepper.boundState(state.stepping, *surface, true);
+
+      // Calibrate the candidates once and select the compatible ones by their
+      // chi2 with respect to the predicted parameters
+      using calibrated_t = std::decay_t<decltype(
+          m_calibrator(*candidates.front(), boundParams))>;
+      boost::container::small_vector<calibrated_t, 8> calibrated;
+      calibrated.reserve(candidates.size());
+      boost::container::small_vector<std::pair<double, size_t>, 8> compatible;
+      for (size_t ic = 0; ic < candidates.size(); ++ic) {
+        calibrated.push_back(m_calibrator(*candidates[ic], boundParams));
+        double chi2 = std::visit(
+            [&](const auto& measurement) {
+              return predictedChi2(measurement, boundParams);
+            },
+            calibrated.back());
+        ACTS_VERBOSE("Candidate with chi2 = " << chi2);
+        if (chi2 < maxChi2) {
+          compatible.emplace_back(chi2, ic);
+        }
+      }
+      std::sort(compatible.begin(), compatible.end(),
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+
+      // Prune by the number of candidates per surface and of branches
+      size_t nBranches = 1 + result.activeBranches.size() +
+                         result.trackTips.size();
+      size_t nSelected = std::min(
+          {compatible.size(), maxBranchesPerSurface,
+           1 + (maxBranches > nBranches ? maxBranches - nBranches : 0)});
+      if (nSelected == 0) {
+        ACTS_VERBOSE("No compatible measurement");
+        addHoleOrMaterialState(surface, state, stepper, result, postUpdate,
+                               &boundParams, &jacobian, pathLength);
+        return Result<void>::success();
+      }
+
+      // Create a track state for each selected candidate, all of them
+      // following the tip of the current branch
+      const Branch parent = result.currentBranch;
+      boost::container::small_vector<size_t, 8> tips;
+      for (size_t ic = 0; ic < nSelected; ++ic) {
+        // the candidates share the predicted parameters and the jacobian
+        TrackStatePropMask::Type mask = TrackStatePropMask::All;
+        if (ic > 0) {
+          mask = ~(TrackStatePropMask::Predicted |
+                   TrackStatePropMask::Jacobian);
+        }
+        size_t tip = result.fittedStates.addTrackState(mask, parent.tip);
+        auto trackStateProxy = result.fittedStates.getTrackState(tip);
+        if (ic == 0) {
+          trackStateProxy.predicted() = boundParams.parameters();
+          trackStateProxy.predictedCovariance() = *boundParams.covariance();
+          trackStateProxy.jacobian() = jacobian;
+        } else {
+          auto first = result.fittedStates.getTrackState(tips.front());
+          trackStateProxy.data().ipredicted = first.data().ipredicted;
+          trackStateProxy.data().ijacobian = first.data().ijacobian;
+        }
+        trackStateProxy.pathLength() = pathLength;
+        trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+        const size_t icandidate = compatible[ic].second;
+        trackStateProxy.uncalibrated() = *candidates[icandidate];
+        std::visit(
+            [&](const auto& measurement) {
+              trackStateProxy.setCalibrated(measurement);
+            },
+            calibrated[icandidate]);
+
+        auto& typeFlags = trackStateProxy.typeFlags();
+        typeFlags.set(TrackStateFlag::MaterialFlag);
+        typeFlags.set(TrackStateFlag::ParameterFlag);
+        typeFlags.set(TrackStateFlag::MeasurementFlag);
+
+        auto updateRes = m_updater(state.geoContext, trackStateProxy, forward);
+        if (!updateRes.ok()) {
+          ACTS_ERROR("Update step failed: " << updateRes.error());
+          return updateRes.error();
+        }
+        tips.push_back(tip);
+      }
+
+      // The best candidate continues the current branch, the others are
+      // followed later, the next best one first
+      for (size_t ic = nSelected; ic-- > 1;) {
+        result.activeBranches.push_back(
+            Branch{tips[ic], tips[ic], parent.nMeasurements + 1,
+                   parent.nHoles});
+      }
+      result.currentBranch =
+          Branch{tips[0], tips[0], parent.nMeasurements + 1, parent.nHoles};
+
+      // Update the stepping state with the filtered parameters
+      auto best = result.fittedStates.getTrackState(tips[0]);
+      ACTS_VERBOSE("Filtering step successful, updated parameters are : \n"
+                   << best.filtered().transpose());
+      stepper.update(state.stepping,
+                     best.filteredParameters(state.options.geoContext));
+
+      // Update state and stepper with post material effects
+      materialInteractor(surface, state, stepper, postUpdate);
+      return Result<void>::success();
+    }
+
+    /// @brief Combinatorial Kalman filter actor operation : hole or material
+    ///
+    /// Adds a track state without measurement if the surface is sensitive
+    /// or has material and the branch has a measurement already.
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param surface The surface without compatible measurement
+    /// @param state The mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result The mutable result state object
+    /// @param updateStage The material update stage still to be applied
+    /// @param boundParams Optional parameters already bound to the surface
+    /// @param jacobian The corresponding jacobian
+    /// @param pathLength The corresponding path length
+    template <typename propagator_state_t, typename stepper_t>
+    void addHoleOrMaterialState(
+        const Surface* surface, propagator_state_t& state,
+        const stepper_t& stepper, result_type& result,
+        MaterialUpdateStage updateStage,
+        const BoundParameters* boundParams = nullptr,
+        const BoundMatrix* jacobian = nullptr, double pathLength = 0.) const {
+      bool sensitive = surface->associatedDetectorElement() != nullptr;
+      if (result.currentBranch.nMeasurements > 0 and
+          (sensitive or surface->surfaceMaterial() != nullptr)) {
+        // No storage allocation for uncalibrated/calibrated measurement and
+        // filtered parameter
+        result.currentBranch.tip = result.fittedStates.addTrackState(
+            ~(TrackStatePropMask::Uncalibrated |
+              TrackStatePropMask::Calibrated | TrackStatePropMask::Filtered),
+            result.currentBranch.tip);
+        auto trackStateProxy =
+            result.fittedStates.getTrackState(result.currentBranch.tip);
+        trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+
+        auto& typeFlags = trackStateProxy.typeFlags();
+        typeFlags.set(TrackStateFlag::MaterialFlag);
+        typeFlags.set(TrackStateFlag::ParameterFlag);
+
+        if (sensitive) {
+          ACTS_VERBOSE("Detected hole on " << surface->geoID());
+          typeFlags.set(TrackStateFlag::HoleFlag);
+          ++result.currentBranch.nHoles;
+          if (boundParams != nullptr) {
+            trackStateProxy.predicted() = boundParams->parameters();
+            trackStateProxy.predictedCovariance() = *boundParams->covariance();
+            trackStateProxy.jacobian() = *jacobian;
+            trackStateProxy.pathLength() = pathLength;
+          } else {
+            auto [params, jac, path] =
+                stepper.boundState(state.stepping, *surface, true);
+            trackStateProxy.predicted() = params.parameters();
+            trackStateProxy.predictedCovariance() = *params.covariance();
+            trackStateProxy.jacobian() = jac;
+            trackStateProxy.pathLength() = path;
+          }
+        } else {
+          ACTS_VERBOSE("Detected in-sensitive surface " << surface->geoID());
+          auto [params, jac, path] =
+              stepper.curvilinearState(state.stepping, true);
+          trackStateProxy.predicted() = params.parameters();
+          trackStateProxy.predictedCovariance() = *params.covariance();
+          trackStateProxy.jacobian() = jac;
+          trackStateProxy.pathLength() = path;
+        }
+        // The filtered parameters are the predicted ones
+        trackStateProxy.data().ifiltered = trackStateProxy.data().ipredicted;
+      }
+      materialInteractor(surface, state, stepper, updateStage);
+    }
+
+    /// @brief Chi2 of a measurement with respect to the predicted parameters
+    ///
+    /// @tparam measurement_t Type of the calibrated measurement
+    ///
+    /// @param measurement The calibrated measurement
+    /// @param predicted The predicted parameters on the measurement surface
+    template <typename measurement_t>
+    double predictedChi2(const measurement_t& measurement,
+                         const BoundParameters& predicted) const {
+      const auto H = measurement.projector();
+      const auto residual = measurement.residual(predicted);
+      const auto S = (H * (*predicted.covariance()) * H.transpose() +
+                      measurement.covariance())
+                         .eval();
+      return residual.dot(S.inverse() * residual);
+    }
+
+    /// @brief Combinatorial Kalman filter actor operation : material
+    /// interaction
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param surface The surface where the material interaction happens
+    /// @param state The mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param updateStage The materal update stage
+    template <typename propagator_state_t, typename stepper_t>
+    void materialInteractor(
+        const Surface* surface, propagator_state_t& state, stepper_t& stepper,
+        const MaterialUpdateStage& updateStage = fullUpdate) const {
+      if (surface and surface->surfaceMaterial()) {
+        // Prepare relevant input particle properties
+        detail::PointwiseMaterialInteraction interaction(surface, state,
+                                                         stepper);
+        // Evaluate the material properties
+        if (interaction.evaluateMaterialProperties(state, updateStage)) {
+          // Evaluate the material effects
+          interaction.evaluatePointwiseMaterialInteraction(multipleScattering,
+                                                           energyLoss);
+          // Update the state and stepper with material effects
+          interaction.updateState(state, stepper);
+        }
+      }
+    }
+
+    /// Pointer to a logger that is owned by the parent, the
+    /// CombinatorialKalmanFilter
+    const Logger* m_logger;
+
+    /// Getter for the logger, to support logging macros
+    const Logger& logger() const { return *m_logger; }
+
+    /// The Kalman updater
+    updater_t m_updater;
+
+    /// The measurement calibrator
+    calibrator_t m_calibrator;
+  };
+
+  template <typename source_link_t>
+  class Aborter {
+   public:
+    /// Broadcast the result_type
+    using action_type = Actor<source_link_t>;
+
+    template <typename propagator_state_t, typename stepper_t,
+              typename result_t>
+    bool operator()(propagator_state_t& /*state*/, const stepper_t& /*stepper*/,
+                    const result_t& result) const {
+      return result.finished;
+    }
+  };
+
+ public:
+  /// Track finding implementation, which follows all branches of the track
+  /// candidates from the given start parameters
+  ///
+  /// @tparam source_link_t Source link type identifying uncalibrated input
+  /// measurements.
+  /// @tparam start_parameters_t Type of the initial parameters
+  ///
+  /// @param sourcelinks The uncalibrated measurements of e.g. a whole event,
+  /// which are searched by surface
+  /// @param sParameters The initial track parameters, e.g. of a seed
+  /// @param ckfOptions CombinatorialKalmanFilterOptions steering the search
+  /// @note The source links must outlive the track finding.
+  ///
+  /// @return the track candidates, i.e. the tips of the branches in the
+  /// shared trajectory
+  template <typename source_link_t, typename start_parameters_t>
+  Result<CombinatorialKalmanFilterResult<source_link_t>> findTracks(
+      const std::vector<source_link_t>& sourcelinks,
+      const start_parameters_t& sParameters,
+      const CombinatorialKalmanFilterOptions& ckfOptions) const {
+    static_assert(SourceLinkConcept<source_link_t>,
+                  "Source link does not fulfill SourceLinkConcept");
+
+    // To be able to find the candidates later, we index them by surface
+    ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
+    detail::SourceLinkLookup<source_link_t> inputMeasurements(sourcelinks);
+
+    // Create the ActionList and AbortList
+    using CKFAborter = Aborter<source_link_t>;
+    using CKFActor = Actor<source_link_t>;
+    using CKFResult = typename CKFActor::result_type;
+    using Actors = ActionList<CKFActor>;
+    using Aborters = AbortList<CKFAborter>;
+
+    // Create relevant options for the propagation options
+    PropagatorOptions<Actors, Aborters> propOptions(ckfOptions.geoContext,
+                                                    ckfOptions.magFieldContext);
+    propOptions.maxSteps = ckfOptions.maxSteps;
+    propOptions.pathLimit = ckfOptions.pathLimit;
+
+    // Catch the actor and set the measurements
+    auto& ckfActor = propOptions.actionList.template get<CKFActor>();
+    ckfActor.m_logger = m_logger.get();
+    ckfActor.inputMeasurements = std::move(inputMeasurements);
+    ckfActor.maxChi2 = ckfOptions.maxChi2;
+    ckfActor.maxBranchesPerSurface = ckfOptions.maxBranchesPerSurface;
+    ckfActor.maxBranches = ckfOptions.maxBranches;
+    ckfActor.maxHoles = ckfOptions.maxHoles;
+    ckfActor.minMeasurements = ckfOptions.minMeasurements;
+    ckfActor.multipleScattering = ckfOptions.multipleScattering;
+    ckfActor.energyLoss = ckfOptions.energyLoss;
+    // also set logger on updater
+    ckfActor.m_updater.m_logger = m_logger;
+
+    // Run the track finding
+    auto result = m_propagator.template propagate(sParameters, propOptions);
+
+    if (!result.ok()) {
+      return result.error();
+    }
+
+    auto& propRes = *result;
+
+    /// Get the result of the track finding
+    auto ckfResult = std::move(propRes.template get<CKFResult>());
+
+    if (!ckfResult.result.ok()) {
+      return ckfResult.result.error();
+    }
+
+    // The propagation could stop before all branches are followed, e.g.
+    // when the step limit is reached. The current and the pending branches
+    // are kept as they are, in the order they would have been followed.
+    if (not ckfResult.finished) {
+      ckfResult.activeBranches.push_back(ckfResult.currentBranch);
+      ACTS_WARNING("Track finding stopped with "
+                   << ckfResult.activeBranches.size()
+                   << " branches not followed to their end");
+      for (auto branch = ckfResult.activeBranches.rbegin();
+           branch != ckfResult.activeBranches.rend(); ++branch) {
+        if (branch->nMeasurements >= ckfOptions.minMeasurements) {
+          ckfResult.trackTips.push_back(branch->lastMeasurement);
+        }
+      }
+      ckfResult.activeBranches.clear();
+    }
+
+    /// It could happen that no track candidate is found.
+    if (ckfResult.trackTips.empty()) {
+      return KalmanFitterError::PropagationInVain;
+    }
+
+    return std::move(ckfResult);
+  }
+};
+
+}  // namespace Acts
@@ -14,6 +14,7 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/detail/covariance_helper.hpp"
 #include "Acts/Fitter/KalmanFitterError.hpp"
+#include "Acts/Fitter/detail/SmoothingGain.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
@@ -22,8 +23,11 @@ namespace Acts {
 /// @brief Kalman smoother implementation based on Gain matrix formalism
 ///
 /// @tparam parameters_t Type of the track parameters
-/// @tparam jacobian_t Type of the Jacobian
-template <typename parameters_t>
+/// @tparam smoothing_gain_t Computation of the smoothing gain matrix, by
+///         default through the inverse of the predicted covariance
+template <typename parameters_t,
+          typename smoothing_gain_t =
+              detail::InverseSmoothingGain<typename parameters_t::CovMatrix_t>>
 class GainMatrixSmoother {
  public:
   /// @brief Gain Matrix smoother implementation
@@ -56,6 +60,7 @@ class GainMatrixSmoother {
 
     // Smoothing gain matrix
     gain_matrix_t G;
+    smoothing_gain_t smoothingGain;
 
     // make sure there is more than one track state
     std::optional<std::error_code> error{std::nullopt};  // assume ok
@@ -65,7 +70,8 @@ class GainMatrixSmoother {
       ACTS_VERBOSE("Start smoothing from previous track state at index: "
                    << prev_ts.previous());
 
-      trajectory.applyBackwards(prev_ts.previous(), [&prev_ts, &G, &error,
+      trajectory.applyBackwards(prev_ts.previous(), [&prev_ts, &G,
+                                                     &smoothingGain, &error,
                                                      this](auto ts) {
         // should have filtered and predicted, this should also include the
         // covariances.
@@ -81,14 +87,11 @@ class GainMatrixSmoother {
         ACTS_VERBOSE("Filtered covariance:\n" << ts.filteredCovariance());
         ACTS_VERBOSE("Jacobian:\n" << ts.jacobian());
         ACTS_VERBOSE("Prev. predicted covariance\n"
-                     << prev_ts.predictedCovariance() << "\n, inverse: \n"
-                     << prev_ts.predictedCovariance().inverse());
+                     << prev_ts.predictedCovariance());
 
         // Gain smoothing matrix
-        G = ts.filteredCovariance() * ts.jacobian().transpose() *
-            prev_ts.predictedCovariance().inverse();
-
-        if (G.hasNaN()) {
+        if (not smoothingGain(ts.filteredCovariance(), ts.jacobian(),
+                              prev_ts.predictedCovariance(), G)) {
           error = KalmanFitterError::SmoothFailed;  // set to error
           return false;                             // abort execution
         }
@@ -113,7 +116,7 @@ class GainMatrixSmoother {
                      << prev_ts.smoothedCovariance());
 
         // And the smoothed covariance
-        ts.smoothedCovariance() =
+        CovMatrix_t smoothedCov =
             ts.filteredCovariance() -
             G * (prev_ts.predictedCovariance() - prev_ts.smoothedCovariance()) *
                 G.transpose();
@@ -122,14 +125,14 @@ class GainMatrixSmoother {
         // If not, make one (could do more) attempt to replace it with the
         // nearest semi-positive def matrix,
         // but it could still be non semi-positive
-        CovMatrix_t smoothedCov = ts.smoothedCovariance();
         if (not detail::covariance_helper<CovMatrix_t>::validate(smoothedCov)) {
           ACTS_DEBUG(
               "Smoothed covariance is not positive definite. Could result in "
               "negative covariance!");
         }
-        // Reset smoothed covariance
-        ts.smoothedCovariance() = smoothedCov;
+        // Symmetrise to remove the rounding asymmetries, which would
+        // otherwise accumulate along the track
+        ts.smoothedCovariance() = 0.5 * (smoothedCov + smoothedCov.transpose());
         ACTS_VERBOSE("Smoothed covariance is: \n" << ts.smoothedCovariance());
 
         prev_ts = ts;
@@ -63,9 +63,6 @@ class GainMatrixUpdater {
     static_assert(std::is_same_v<track_state_t, TrackStateProxy>,
                   "Given track state type is not a track state proxy");
 
-    using CovMatrix_t = typename parameters_t::CovMatrix_t;
-    using ParVector_t = typename parameters_t::ParVector_t;
-
     // we should definitely have an uncalibrated measurement here
     assert(trackState.hasUncalibrated());
     // there should be a calibrated measurement
@@ -107,10 +104,15 @@ class GainMatrixUpdater {
 
           ACTS_VERBOSE("Measurement projector H:\n" << H);
 
-          const ActsMatrixD<eBoundParametersSize, measdim> K =
-              predicted_covariance * H.transpose() *
-              (H * predicted_covariance * H.transpose() + calibrated_covariance)
-                  .inverse();
+          // All products involving the full covariance are done once with the
+          // projector, the rest of the update runs on matrices of the
+          // measurement dimension.
+          const ActsMatrixD<eBoundParametersSize, measdim> PHt =
+              predicted_covariance * H.transpose();
+          // residual covariance, inverted in closed form for the fixed size
+          const cov_t S = H * PHt + calibrated_covariance;
+          const cov_t Sinv = S.inverse();
+          const ActsMatrixD<eBoundParametersSize, measdim> K = PHt * Sinv;
 
           ACTS_VERBOSE("Gain Matrix K:\n" << K);
 
@@ -122,25 +124,24 @@ class GainMatrixUpdater {
             return false;  // abort execution
           }
 
-          filtered = predicted + K * (calibrated - H * predicted);
-          filtered_covariance =
-              (ActsSymMatrixD<
-                   MultiTrajectory<SourceLink>::ParametersSize>::Identity() -
-               K * H) *
-              predicted_covariance;
+          // predicted residual
+          const par_t residual = calibrated - H * predicted;
+          ACTS_VERBOSE("Residual: " << residual.transpose());
+
+          filtered = predicted + K * residual;
+          // (1 - K H) P = P - K (P H^T)^T, which only needs products with the
+          // measurement dimension. Rounding leaves the difference slightly
+          // asymmetric, hence it is symmetrised explicitly.
+          const ActsSymMatrixD<eBoundParametersSize> updated =
+              predicted_covariance - K * PHt.transpose();
+          filtered_covariance = 0.5 * (updated + updated.transpose());
           ACTS_VERBOSE("Filtered parameters: " << filtered.transpose());
           ACTS_VERBOSE("Filtered covariance:\n" << filtered_covariance);
 
-          // calculate filtered residual
-          par_t residual(trackState.calibratedSize());
-          residual = (calibrated - H * filtered);
-          ACTS_VERBOSE("Residual: " << residual.transpose());
-
-          trackState.chi2() =
-              (residual.transpose() *
-               ((cov_t::Identity() - H * K) * calibrated_covariance).inverse() *
-               residual)
-                  .value();
+          // The chi2 of the filtered residual with respect to its covariance
+          // (1 - H K) V equals the one of the predicted residual with respect
+          // to S, which avoids a second inversion.
+          trackState.chi2() = residual.dot(Sinv * residual);
 
           ACTS_VERBOSE("Chi2: " << trackState.chi2());
           return true;  // continue execution
@@ -0,0 +1,600 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/EventData/TrackState.hpp"
+#include "Acts/Fitter/KalmanFitterError.hpp"
+#include "Acts/Fitter/detail/BetheHeitlerApprox.hpp"
+#include "Acts/Fitter/detail/GaussianMixtureReduction.hpp"
+#include "Acts/Fitter/detail/SourceLinkLookup.hpp"
+#include "Acts/Fitter/detail/VoidKalmanComponents.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Options struct how the Gaussian-sum fitter is called
+///
+/// It contains the context of the fitter call, the bounds on the number of
+/// components and configurations for material effects.
+///
+/// @note the context objects must be provided
+struct GaussianSumFitterOptions {
+  /// Deleted default constructor
+  GaussianSumFitterOptions() = delete;
+
+  /// PropagatorOptions with context
+  ///
+  /// @param gctx The goemetry context for this fit
+  /// @param mctx The magnetic context for this fit
+  /// @param cctx The calibration context for this fit
+  /// @param mScattering Whether to include multiple scattering
+  /// @param eLoss Whether to include energy loss
+  GaussianSumFitterOptions(
+      std::reference_wrapper<const GeometryContext> gctx,
+      std::reference_wrapper<const MagneticFieldContext> mctx,
+      std::reference_wrapper<const CalibrationContext> cctx,
+      bool mScattering = true, bool eLoss = true)
+      : geoContext(gctx),
+        magFieldContext(mctx),
+        calibrationContext(cctx),
+        multipleScattering(mScattering),
+        energyLoss(eLoss) {}
+
+  /// Context object for the geometry
+  std::reference_wrapper<const GeometryContext> geoContext;
+  /// Context object for the magnetic field
+  std::reference_wrapper<const MagneticFieldContext> magFieldContext;
+  /// context object for the calibration
+  std::reference_wrapper<const CalibrationContext> calibrationContext;
+
+  /// Maximum number of components of the track parameter mixture
+  size_t maxComponents = 12;
+
+  /// Number of components of the Bethe-Heitler approximation
+  size_t betheHeitlerComponents = 6;
+
+  /// Components with a smaller weight are dropped after each update, the
+  /// component with the highest weight is always kept
+  double weightCutoff = 1e-4;
+
+  /// The fitted particle, electrons by default
+  int absPdgCode = 11;
+  double mass = 0.51099895 * UnitConstants::MeV;
+
+  /// Whether to consider multiple scattering
+  bool multipleScattering = true;
+
+  /// Whether to consider energy loss
+  bool energyLoss = true;
+};
+
+template <typename source_link_t>
+struct GaussianSumFitterResult {
+  // Fitted states that the actor has handled, holding the collapsed mixture
+  // of the predicted and filtered parameters on each measurement surface
+  MultiTrajectory<source_link_t> fittedStates;
+
+  // This is the index of the 'tip' of the track stored in multitrajectory.
+  size_t trackTip = SIZE_MAX;
+
+  // The collapsed filtered parameters on the last measurement surface
+  std::optional<BoundParameters> fittedParameters;
+
+  // The components of the track parameters on the last handled surface
+  detail::GaussianMixture components;
+
+  // The parameters of the propagated state on the last handled surface,
+  // around which the components are transported
+  BoundVector reference = BoundVector::Zero();
+
+  // Counter for states with measurements
+  size_t measurementStates = 0;
+
+  // Indicator if initialization has been performed.
+  bool initialized = false;
+
+  // Indicator if the end of the navigation is reached
+  bool finished = false;
+
+  Result<void> result{Result<void>::success()};
+};
+
+/// @brief Gaussian-sum filter for electrons as a plugin to the Propagator
+///
+/// @tparam propagator_t Type of the propagation class
+/// @tparam calibrator_t Type of the calibrator class
+///
+/// The track parameters are described by a weighted mixture of Gaussian
+/// components. On each surface with material, the energy loss by
+/// bremsstrahlung is described by the Gaussian mixture approximation of the
+/// Bethe-Heitler distribution, i.e. every component is split into one
+/// component per Bethe-Heitler component. On each measurement surface, every
+/// component is updated with the Kalman gain formalism and reweighted by the
+/// likelihood of the measurement. The number of components is bounded by
+/// merging after each surface, which bounds the cost of the fit.
+///
+/// All components are propagated in a single navigation pass: the
+/// propagator transports the collapsed mixture, i.e. its mean and
+/// covariance, and each component is transported to the next surface with
+/// the jacobian of this transport around its difference to the mean. The
+/// components differ mostly in q/p, for which this linearisation holds
+/// for the distances between neighbouring surfaces.
+///
+/// There is no smoothing, the fitted parameters are the collapsed filtered
+/// parameters on the last measurement surface.
+template <typename propagator_t,
+          typename calibrator_t = VoidMeasurementCalibrator>
+class GaussianSumFitter {
+ public:
+  /// Default constructor is deleted
+  GaussianSumFitter() = delete;
+
+  /// Constructor from arguments
+  GaussianSumFitter(propagator_t pPropagator,
+                    std::unique_ptr<const Logger> logger =
+                        getDefaultLogger("GaussianSumFitter", Logging::INFO))
+      : m_propagator(std::move(pPropagator)), m_logger(logger.release()) {}
+
+ private:
+  /// The propgator for the transport and material update
+  propagator_t m_propagator;
+
+  /// Logger getter to support macros
+  const Logger& logger() const { return *m_logger; }
+
+  /// Owned logging instance
+  std::shared_ptr<const Logger> m_logger;
+
+  /// @brief Propagator Actor plugin for the GaussianSumFitter
+  ///
+  /// @tparam source_link_t is an type fulfilling the @c SourceLinkConcept
+  template <typename source_link_t>
+  class Actor {
+   public:
+    /// Broadcast the result_type
+    using result_type = GaussianSumFitterResult<source_link_t>;
+
+    /// Allows retrieving measurements for a surface
+    detail::SourceLinkLookup<source_link_t> inputMeasurements;
+
+    /// The fitter options without the contexts
+    size_t maxComponents = 12;
+    double weightCutoff = 1e-4;
+    bool multipleScattering = true;
+    bool energyLoss = true;
+
+    /// The approximation of the bremsstrahlung energy loss
+    detail::BetheHeitlerApprox betheHeitler;
+
+    /// @brief Gaussian-sum filter actor operation
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param state is the mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result is the mutable result state object
+    template <typename propagator_state_t, typename stepper_t>
+    void operator()(propagator_state_t& state, const stepper_t& stepper,
+                    result_type& result) const {
+      if (result.finished) {
+        return;
+      }
+      ACTS_VERBOSE("GaussianSumFitter step");
+
+      // Initialize the mixture with the start parameters
+      if (!result.initialized) {
+        auto [start, jacobian, pathLength] =
+            stepper.curvilinearState(state.stepping, true);
+        result.components.reserve(maxComponents *
+                                  betheHeitler.nComponents);
+        result.components.push_back(
+            {1., start.parameters(), *start.covariance()});
+        result.reference = start.parameters();
+        result.fittedStates.reserve(inputMeasurements.size());
+        result.initialized = true;
+        return;
+      }
+
+      // Update:
+      // - Waiting for a current surface
+      auto surface = state.navigation.currentSurface;
+      if (surface != nullptr) {
+        auto res = filter(surface, state, stepper, result);
+        if (!res.ok()) {
+          ACTS_ERROR("Error in filter: " << res.error());
+          result.result = res.error();
+        }
+      }
+
+      // Finalization:
+      // - The fitted parameters are the last filtered parameters
+      if (state.navigation.navigationBreak) {
+        if (result.trackTip != SIZE_MAX) {
+          auto st = result.fittedStates.getTrackState(result.trackTip);
+          result.fittedParameters = st.filteredParameters(state.geoContext);
+        }
+        result.finished = true;
+      }
+    }
+
+    /// @brief Gaussian-sum filter actor operation : update
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param surface The surface where the update happens
+    /// @param state The mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result The mutable result state object
+    template <typename propagator_state_t, typename stepper_t>
+    Result<void> filter(const Surface* surface, propagator_state_t& state,
+                        const stepper_t& stepper, result_type& result) const {
+      const source_link_t* sourcelink = inputMeasurements.find(surface);
+      if (sourcelink == nullptr and surface->surfaceMaterial() == nullptr) {
+        return Result<void>::success();
+      }
+
+      // Transport the propagated state & bind it to the current surface
+      auto [boundParams, jacobian, pathLength] =
+          stepper.boundState(state.stepping, *surface, true);
+      transportComponents(result, boundParams.parameters(), jacobian);
+
+      if (sourcelink != nullptr) {
+        ACTS_VERBOSE("Measurement surface " << surface->geoID()
+                                            << " detected.");
+        // Update the components with pre material effects
+        materialInteractor(surface, state, stepper, result, preUpdate);
+
+        result.trackTip = result.fittedStates.addTrackState(
+            TrackStatePropMask::All, result.trackTip);
+        auto trackStateProxy =
+            result.fittedStates.getTrackState(result.trackTip);
+        trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+        auto [predicted, predictedCovariance] =
+            detail::collapse(result.components);
+        trackStateProxy.predicted() = predicted;
+        trackStateProxy.predictedCovariance() = predictedCovariance;
+        trackStateProxy.jacobian() = jacobian;
+        trackStateProxy.pathLength() = pathLength;
+        trackStateProxy.uncalibrated() = *sourcelink;
+
+        auto& typeFlags = trackStateProxy.typeFlags();
+        typeFlags.set(TrackStateFlag::MaterialFlag);
+        typeFlags.set(TrackStateFlag::MeasurementFlag);
+        typeFlags.set(TrackStateFlag::ParameterFlag);
+
+        // Calibrate and update every component
+        std::optional<std::error_code> error{std::nullopt};  // assume ok
+        std::visit(
+            [&](const auto& calibrated) {
+              trackStateProxy.setCalibrated(calibrated);
+              auto chi2 = updateComponents(calibrated, result.components);
+              if (!chi2.ok()) {
+                error = chi2.error();
+                return;
+              }
+              trackStateProxy.chi2() = *chi2;
+            },
+            m_calibrator(trackStateProxy.uncalibrated(), boundParams));
+        if (error) {
+          return *error;
+        }
+
+        auto [filtered, filteredCovariance] =
+            detail::collapse(result.components);
+        trackStateProxy.filtered() = filtered;
+        trackStateProxy.filteredCovariance() = filteredCovariance;
+        ACTS_VERBOSE("Filtering step successful with "
+                     << result.components.size()
+                     << " components, collapsed parameters are : \n"
+                     << trackStateProxy.filtered().transpose());
+        ++result.measurementStates;
+
+        // Update the components with post material effects
+        materialInteractor(surface, state, stepper, result, postUpdate);
+      } else {
+        // Update the components with the full material effects
+        materialInteractor(surface, state, stepper, result, fullUpdate);
+      }
+
+      // Continue the propagation with the collapsed mixture
+      auto [mean, covariance] = detail::collapse(result.components);
+      result.reference = mean;
+      stepper.update(state.stepping,
+                     BoundParameters(state.geoContext, covariance, mean,
+                                     surface->getSharedPtr()));
+      return Result<void>::success();
+    }
+
+    /// @brief Transport the components to the current surface
+    ///
+    /// The components are transported with the jacobian of the propagated
+    /// state, linearised around their difference to it.
+    ///
+    /// @param result The mutable result state object
+    /// @param parameters The propagated parameters on the current surface
+    /// @param jacobian The transport jacobian of the propagated state
+    void transportComponents(result_type& result,
+                             const BoundVector& parameters,
+                             const BoundMatrix& jacobian) const {
+      for (auto& cmp : result.components) {
+        cmp.parameters =
+            parameters + jacobian * (cmp.parameters - result.reference);
+        cmp.covariance = jacobian * cmp.covariance * jacobian.transpose();
+      }
+    }
+
+    /// @brief Update all components with a measurement
+    ///
+    /// Each component is updated with the gain matrix formalism and its
+    /// weight is multiplied with the likelihood of the measurement.
+    ///
+    /// @tparam measurement_t Type of the calibrated measurement
+    ///
+    /// @param measurement The calibrated measurement
+    /// @param components The components on the measurement surface
+    ///
+    /// @return the weighted chi2 of the predicted residuals
+    template <typename measurement_t>
+    Result<double> updateComponents(const measurement_t& measurement,
+                                    detail::GaussianMixture& components) const {
+      const auto H = measurement.projector();
+      const auto V = measurement.covariance();
+      using cov_t = std::decay_t<decltype(V)>;
+      constexpr int measdim = cov_t::RowsAtCompileTime;
+
+      // The logarithms of the weights, to avoid underflows of the likelihood
+      boost::container::small_vector<double, 64> logWeights;
+      double maxLogWeight = -std::numeric_limits<double>::infinity();
+      double chi2 = 0.;
+      for (auto& cmp : components) {
+        const ActsMatrixD<eBoundParametersSize, measdim> PHt =
+            cmp.covariance * H.transpose();
+        const cov_t S = H * PHt + V;
+        const cov_t Sinv = S.inverse();
+        const ActsMatrixD<eBoundParametersSize, measdim> K = PHt * Sinv;
+        if (K.hasNaN()) {
+          return KalmanFitterError::ForwardUpdateFailed;
+        }
+        const auto residual = measurement.residual(cmp.parameters);
+        cmp.parameters += K * residual;
+        cmp.covariance -= K * PHt.transpose();
+
+        const double cmpChi2 = residual.dot(Sinv * residual);
+        chi2 += cmp.weight * cmpChi2;
+        logWeights.push_back(std::log(cmp.weight) - 0.5 * cmpChi2 -
+                             0.5 * std::log(S.determinant()));
+        maxLogWeight = std::max(maxLogWeight, logWeights.back());
+      }
+      for (size_t ic = 0; ic < components.size(); ++ic) {
+        components[ic].weight = std::exp(logWeights[ic] - maxLogWeight);
+      }
+      detail::normalizeWeights(components);
+
+      // Drop the negligible components, the best one is always kept
+      detail::removeLowWeights(components, weightCutoff);
+      return chi2;
+    }
+
+    /// @brief Gaussian-sum filter actor operation : material interaction
+    ///
+    /// Multiple scattering and ionisation are applied to every component as
+    /// in the KalmanFitter. The bremsstrahlung splits every component by the
+    /// Bethe-Heitler mixture, after which the mixture is reduced.
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param surface The surface where the material interaction happens
+    /// @param state The mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result The mutable result state object
+    /// @param updateStage The materal update stage
+    template <typename propagator_state_t, typename stepper_t>
+    void materialInteractor(const Surface* surface, propagator_state_t& state,
+                            const stepper_t& stepper, result_type& result,
+                            const MaterialUpdateStage& updateStage) const {
+      if (surface->surfaceMaterial() == nullptr) {
+        return;
+      }
+      // Evaluate the material effects for the propagated state
+      detail::PointwiseMaterialInteraction interaction(surface, state,
+                                                       stepper);
+      if (not interaction.evaluateMaterialProperties(state, updateStage)) {
+        return;
+      }
+      interaction.evaluatePointwiseMaterialInteraction(multipleScattering,
+                                                       energyLoss);
+
+      // Change of q/p by the mean ionisation loss
+      double dqop = 0.;
+      if (energyLoss) {
+        const double energy =
+            std::hypot(interaction.mass, interaction.momentum);
+        const double nextE = energy - interaction.Eloss;
+        if (interaction.mass < nextE) {
+          const double nextP = std::sqrt(nextE * nextE -
+                                         interaction.mass * interaction.mass);
+          dqop = interaction.q / nextP - interaction.qOverP;
+        }
+      }
+      for (auto& cmp : result.components) {
+        cmp.parameters[eQOP] += dqop;
+        cmp.covariance(ePHI, ePHI) += interaction.variancePhi;
+        cmp.covariance(eTHETA, eTHETA) += interaction.varianceTheta;
+        cmp.covariance(eQOP, eQOP) += interaction.varianceQoverP;
+      }
+      if (not energyLoss) {
+        return;
+      }
+
+      // Split the components by the bremsstrahlung energy loss, the q/p
+      // of a component scales with the inverse of the kept energy fraction
+      const auto bhMixture =
+          betheHeitler.mixture(interaction.slab.thicknessInX0());
+      ACTS_VERBOSE("Bethe-Heitler mixture with " << bhMixture.size()
+                                                 << " components for "
+                                                 << interaction.slab
+                                                        .thicknessInX0()
+                                                 << " X0");
+      if (bhMixture.size() > 1) {
+        const size_t nComponents = result.components.size();
+        for (size_t ic = 0; ic < nComponents; ++ic) {
+          const detail::GaussianComponent cmp = result.components[ic];
+          const double qop = cmp.parameters[eQOP];
+          for (size_t ib = 0; ib < bhMixture.size(); ++ib) {
+            const auto& bh = bhMixture[ib];
+            // the first split replaces the original component
+            auto& split = (ib == 0) ? result.components[ic]
+                                    : result.components.emplace_back(cmp);
+            split.weight = cmp.weight * bh.weight;
+            split.parameters[eQOP] = qop / bh.mean;
+            split.covariance(eQOP, eQOP) +=
+                qop * qop * bh.variance / std::pow(bh.mean, 4);
+          }
+        }
+      } else {
+        for (auto& cmp : result.components) {
+          const auto& bh = bhMixture.front();
+          const double qop = cmp.parameters[eQOP];
+          cmp.parameters[eQOP] = qop / bh.mean;
+          cmp.covariance(eQOP, eQOP) +=
+              qop * qop * bh.variance / std::pow(bh.mean, 4);
+        }
+      }
+      detail::reduceMixture(result.components, maxComponents);
+    }
+
+    /// Pointer to a logger that is owned by the parent, GaussianSumFitter
+    const Logger* m_logger;
+
+    /// Getter for the logger, to support logging macros
+    const Logger& logger() const { return *m_logger; }
+
+    /// The measurement calibrator
+    calibrator_t m_calibrator;
+  };
+
+  template <typename source_link_t>
+  class Aborter {
+   public:
+    /// Broadcast the result_type
+    using action_type = Actor<source_link_t>;
+
+    template <typename propagator_state_t, typename stepper_t,
+              typename result_t>
+    bool operator()(propagator_state_t& /*state*/, const stepper_t& /*stepper*/,
+                    const result_t& result) const {
+      return result.finished or !result.result.ok();
+    }
+  };
+
+ public:
+  /// Fit implementation of the Gaussian-sum filter
+  ///
+  /// @tparam source_link_t Source link type identifying uncalibrated input
+  /// measurements.
+  /// @tparam start_parameters_t Type of the initial parameters
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements
+  /// @param sParameters The initial track parameters
+  /// @param gsfOptions GaussianSumFitterOptions steering the fit
+  /// @note The input measurements are given in the form of @c SourceLinks.
+  /// It's @c calibrator_t's job to turn them into calibrated measurements
+  /// used in the fit.
+  ///
+  /// @return the output as an output track
+  template <typename source_link_t, typename start_parameters_t>
+  Result<GaussianSumFitterResult<source_link_t>> fit(
+      const std::vector<source_link_t>& sourcelinks,
+      const start_parameters_t& sParameters,
+      const GaussianSumFitterOptions& gsfOptions) const {
+    static_assert(SourceLinkConcept<source_link_t>,
+                  "Source link does not fulfill SourceLinkConcept");
+
+    // To be able to find measurements later, we put them into a lookup
+    ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
+    detail::SourceLinkLookup<source_link_t> inputMeasurements(sourcelinks);
+
+    // Create the ActionList and AbortList
+    using GSFAborter = Aborter<source_link_t>;
+    using GSFActor = Actor<source_link_t>;
+    using GSFResult = typename GSFActor::result_type;
+    using Actors = ActionList<GSFActor>;
+    using Aborters = AbortList<GSFAborter>;
+
+    // Create relevant options for the propagation options
+    PropagatorOptions<Actors, Aborters> propOptions(gsfOptions.geoContext,
+                                                    gsfOptions.magFieldContext);
+    propOptions.absPdgCode = gsfOptions.absPdgCode;
+    propOptions.mass = gsfOptions.mass;
+
+    // Catch the actor and set the measurements
+    auto& gsfActor = propOptions.actionList.template get<GSFActor>();
+    gsfActor.m_logger = m_logger.get();
+    gsfActor.inputMeasurements = std::move(inputMeasurements);
+    gsfActor.maxComponents = gsfOptions.maxComponents;
+    gsfActor.weightCutoff = gsfOptions.weightCutoff;
+    gsfActor.multipleScattering = gsfOptions.multipleScattering;
+    gsfActor.energyLoss = gsfOptions.energyLoss;
+    gsfActor.betheHeitler.nComponents = gsfOptions.betheHeitlerComponents;
+
+    // Run the fitter
+    auto result = m_propagator.template propagate(sParameters, propOptions);
+
+    if (!result.ok()) {
+      return result.error();
+    }
+
+    auto& propRes = *result;
+
+    /// Get the result of the fit
+    auto gsfResult = std::move(propRes.template get<GSFResult>());
+
+    /// It could happen that the fit ends in zero processed states.
+    /// The result gets meaningless so such case is regarded as fit failure.
+    if (gsfResult.result.ok() and not gsfResult.measurementStates) {
+      gsfResult.result = Result<void>(KalmanFitterError::PropagationInVain);
+    }
+
+    if (!gsfResult.result.ok()) {
+      return gsfResult.result.error();
+    }
+
+    // Return the converted Track
+    return std::move(gsfResult);
+  }
+};
+
+}  // namespace Acts
@@ -15,6 +15,7 @@
 #include "Acts/EventData/TrackState.hpp"
 #include "Acts/EventData/TrackStateSorters.hpp"
 #include "Acts/Fitter/KalmanFitterError.hpp"
+#include "Acts/Fitter/detail/SourceLinkLookup.hpp"
 #include "Acts/Fitter/detail/VoidKalmanComponents.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
@@ -31,10 +32,12 @@
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/detail/ParallelMap.hpp"
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <stdexcept>
 
 namespace Acts {
 
@@ -105,9 +108,14 @@ struct KalmanFitterOptions {
 
 template <typename source_link_t>
 struct KalmanFitterResult {
-  // Fitted states that the actor has handled.
+  // Fitted states that the actor has handled, if no shared trajectory is used.
   MultiTrajectory<source_link_t> fittedStates;
 
+  // Optional external trajectory, e.g. holding all tracks of an event, which
+  // is shared with other fits. If set, the track states are appended to it
+  // and fittedStates only holds the detached states of the backward filter.
+  MultiTrajectory<source_link_t>* sharedStates = nullptr;
+
   // This is the index of the 'tip' of the track stored in multitrajectory.
   // Since this KF only stores one trajectory, it is unambiguous.
   // SIZE_MAX is the start of a trajectory.
@@ -138,6 +146,17 @@ struct KalmanFitterResult {
   std::vector<const Surface*> passedAgainSurfaces;
 
   Result<void> result{Result<void>::success()};
+
+  /// The trajectory holding the track states of this fit, i.e. the shared
+  /// trajectory if set and the owned fitted states otherwise.
+  MultiTrajectory<source_link_t>& trajectory() {
+    return sharedStates != nullptr ? *sharedStates : fittedStates;
+  }
+
+  /// The trajectory holding the track states of this fit (read-only).
+  const MultiTrajectory<source_link_t>& trajectory() const {
+    return sharedStates != nullptr ? *sharedStates : fittedStates;
+  }
 };
 
 /// @brief Kalman fitter implementation of Acts as a plugin
@@ -255,7 +274,7 @@ class KalmanFitter {
     const Surface* targetSurface = nullptr;
 
     /// Allows retrieving measurements for a surface
-    std::map<const Surface*, source_link_t> inputMeasurements;
+    detail::SourceLinkLookup<source_link_t> inputMeasurements;
 
     /// Whether to consider multiple scattering.
     bool multipleScattering = true;
@@ -266,6 +285,9 @@ class KalmanFitter {
     /// Whether run smoothing as backward filtering
     bool backwardFiltering = false;
 
+    /// Optional trajectory shared with other fits to store the track states
+    MultiTrajectory<source_link_t>* sharedStates = nullptr;
+
     /// @brief Kalman actor operation
     ///
     /// @tparam propagator_state_t is the type of Propagagor state
@@ -363,7 +385,7 @@ class KalmanFitter {
 
         // Reset smoothed status of states missed in backward filtering
         if (backwardFiltering) {
-          result.fittedStates.applyBackwards(result.trackTip, [&](auto state) {
+          result.trajectory().applyBackwards(result.trackTip, [&](auto state) {
             auto fSurface = &state.referenceSurface();
             auto surface_it = std::find_if(
                 result.passedAgainSurfaces.begin(),
@@ -389,7 +411,10 @@ class KalmanFitter {
     /// @param result is the mutable result state object
     template <typename propagator_state_t, typename stepper_t>
     void initialize(propagator_state_t& /*state*/, const stepper_t& /*stepper*/,
-                    result_type& /*result*/) const {}
+                    result_type& result) const {
+      // Store the track states in the shared trajectory if there is one
+      result.sharedStates = sharedStates;
+    }
 
     /// @brief Kalman actor operation : reverse direction
     ///
@@ -411,7 +436,7 @@ class KalmanFitter {
       // Reset stepping&navigation state using last measurement track state on
       // sensitive surface
       state.navigation = typename propagator_t::NavigatorState();
-      result.fittedStates.applyBackwards(result.trackTip, [&](auto st) {
+      result.trajectory().applyBackwards(result.trackTip, [&](auto st) {
         if (st.hasUncalibrated()) {
           // Set the navigation state
           state.navigation.startSurface = &st.referenceSurface();
@@ -467,8 +492,8 @@ class KalmanFitter {
     Result<void> filter(const Surface* surface, propagator_state_t& state,
                         const stepper_t& stepper, result_type& result) const {
       // Try to find the surface in the measurement surfaces
-      auto sourcelink_it = inputMeasurements.find(surface);
-      if (sourcelink_it != inputMeasurements.end()) {
+      const source_link_t* sourcelink = inputMeasurements.find(surface);
+      if (sourcelink != nullptr) {
         // Screen output message
         ACTS_VERBOSE("Measurement surface " << surface->geoID()
                                             << " detected.");
@@ -482,15 +507,15 @@ class KalmanFitter {
 
         // add a full TrackState entry multi trajectory
         // (this allocates storage for all components, we will set them later)
-        result.trackTip = result.fittedStates.addTrackState(
+        result.trackTip = result.trajectory().addTrackState(
             TrackStatePropMask::All, result.trackTip);
 
         // now get track state proxy back
         auto trackStateProxy =
-            result.fittedStates.getTrackState(result.trackTip);
+            result.trajectory().getTrackState(result.trackTip);
 
         // assign the source link to the track state
-        trackStateProxy.uncalibrated() = sourcelink_it->second;
+        trackStateProxy.uncalibrated() = *sourcelink;
 
         // Fill the track state
         trackStateProxy.predicted() = boundParams.parameters();
@@ -552,14 +577,14 @@ class KalmanFitter {
           // No source links on surface, add either hole or passive material
           // TrackState entry multi trajectory. No storage allocation for
           // uncalibrated/calibrated measurement and filtered parameter
-          result.trackTip = result.fittedStates.addTrackState(
+          result.trackTip = result.trajectory().addTrackState(
               ~(TrackStatePropMask::Uncalibrated |
                 TrackStatePropMask::Calibrated | TrackStatePropMask::Filtered),
               result.trackTip);
 
           // now get track state proxy back
           auto trackStateProxy =
-              result.fittedStates.getTrackState(result.trackTip);
+              result.trajectory().getTrackState(result.trackTip);
 
           // Set the surface
           trackStateProxy.setReferenceSurface(surface->getSharedPtr());
@@ -630,8 +655,8 @@ class KalmanFitter {
                                 const stepper_t& stepper,
                                 result_type& result) const {
       // Try to find the surface in the measurement surfaces
-      auto sourcelink_it = inputMeasurements.find(surface);
-      if (sourcelink_it != inputMeasurements.end()) {
+      const source_link_t* sourcelink = inputMeasurements.find(surface);
+      if (sourcelink != nullptr) {
         // Screen output message
         ACTS_VERBOSE("Measurement surface "
                      << surface->geoID()
@@ -652,7 +677,7 @@ class KalmanFitter {
         auto [boundParams, jacobian, pathLength] =
             stepper.boundState(state.stepping, *surface, true);
 
-        // Create a detached track state proxy
+        // Create a detached track state proxy, outside of a shared trajectory
         auto tempTrackTip =
             result.fittedStates.addTrackState(TrackStatePropMask::All);
 
@@ -660,7 +685,7 @@ class KalmanFitter {
         auto trackStateProxy = result.fittedStates.getTrackState(tempTrackTip);
 
         // Assign the source link to the detached track state
-        trackStateProxy.uncalibrated() = sourcelink_it->second;
+        trackStateProxy.uncalibrated() = *sourcelink;
 
         // Fill the track state
         trackStateProxy.predicted() = boundParams.parameters();
@@ -689,7 +714,7 @@ class KalmanFitter {
               << trackStateProxy.filtered().transpose());
 
           // Fill the smoothed parameter for the existing track state
-          result.fittedStates.applyBackwards(result.trackTip, [&](auto state) {
+          result.trajectory().applyBackwards(result.trackTip, [&](auto state) {
             auto fSurface = &state.referenceSurface();
             if (fSurface == surface) {
               result.passedAgainSurfaces.push_back(surface);
@@ -805,13 +830,13 @@ class KalmanFitter {
 
       // Get the index of measurement states;
       std::vector<size_t> measurementIndices;
-      auto lastState = result.fittedStates.getTrackState(result.trackTip);
+      auto lastState = result.trajectory().getTrackState(result.trackTip);
       if (lastState.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
         measurementIndices.push_back(result.trackTip);
       }
       // Count track states to be smoothed
       size_t nStates = 0;
-      result.fittedStates.applyBackwards(result.trackTip, [&](auto st) {
+      result.trajectory().applyBackwards(result.trackTip, [&](auto st) {
         // Smoothing will start from the last measurement state
         if (measurementIndices.empty()) {
           // No smoothed parameter for the last few non-measurment states
@@ -821,7 +846,7 @@ class KalmanFitter {
         }
         size_t iprevious = st.previous();
         if (iprevious != Acts::detail_lt::IndexData::kInvalid) {
-          auto previousState = result.fittedStates.getTrackState(iprevious);
+          auto previousState = result.trajectory().getTrackState(iprevious);
           if (previousState.typeFlags().test(
                   Acts::TrackStateFlag::MeasurementFlag)) {
             measurementIndices.push_back(iprevious);
@@ -839,7 +864,7 @@ class KalmanFitter {
                                            << " filtered track states.");
       }
       // Smooth the track states
-      auto smoothRes = m_smoother(state.geoContext, result.fittedStates,
+      auto smoothRes = m_smoother(state.geoContext, result.trajectory(),
                                   measurementIndices.front());
 
       if (!smoothRes.ok()) {
@@ -848,7 +873,7 @@ class KalmanFitter {
       }
       // Obtain the smoothed parameters at first measurement state
       auto firstMeasurement =
-          result.fittedStates.getTrackState(measurementIndices.back());
+          result.trajectory().getTrackState(measurementIndices.back());
       parameters_t smoothedPars =
           firstMeasurement.smoothedParameters(state.options.geoContext);
 
@@ -921,6 +946,9 @@ class KalmanFitter {
   /// @param sourcelinks The fittable uncalibrated measurements
   /// @param sParameters The initial track parameters
   /// @param kfOptions KalmanOptions steering the fit
+  /// @param trajectory Optional trajectory shared with other fits, e.g. of
+  /// the same event, to which the track states are appended. The result then
+  /// only holds the index of the track tip in this trajectory.
   /// @note The input measurements are given in the form of @c SourceLinks. It's
   /// @c calibrator_t's job to turn them into calibrated measurements used in
   /// the fit.
@@ -932,7 +960,8 @@ class KalmanFitter {
             typename result_t = Result<KalmanFitterResult<source_link_t>>>
   auto fit(const std::vector<source_link_t>& sourcelinks,
            const start_parameters_t& sParameters,
-           const kalman_fitter_options_t& kfOptions) const
+           const kalman_fitter_options_t& kfOptions,
+           MultiTrajectory<source_link_t>* trajectory = nullptr) const
       -> std::enable_if_t<!isDirectNavigator, result_t> {
     static_assert(SourceLinkConcept<source_link_t>,
                   "Source link does not fulfill SourceLinkConcept");
@@ -943,14 +972,10 @@ class KalmanFitter {
         "Inconsistent type of outlier finder between kalman fitter and "
         "kalman fitter options");
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
+    // To be able to find measurements later, we index them by surface. The
+    // source links are only referenced, they outlive the propagation.
     ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
-    std::map<const Surface*, source_link_t> inputMeasurements;
-    for (const auto& sl : sourcelinks) {
-      const Surface* srf = &sl.referenceSurface();
-      inputMeasurements.emplace(srf, sl);
-    }
+    detail::SourceLinkLookup<source_link_t> inputMeasurements(sourcelinks);
 
     // Create the ActionList and AbortList
     using KalmanAborter = Aborter<source_link_t, parameters_t>;
@@ -971,6 +996,7 @@ class KalmanFitter {
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
     kalmanActor.backwardFiltering = kfOptions.backwardFiltering;
+    kalmanActor.sharedStates = trajectory;
 
     // Set config for outlier finder
     kalmanActor.m_outlierFinder = kfOptions.outlierFinder;
@@ -979,17 +1005,26 @@ class KalmanFitter {
     kalmanActor.m_updater.m_logger = m_logger;
     kalmanActor.m_smoother.m_logger = m_logger;
 
+    // The states of a failed fit are removed from the shared trajectory
+    const size_t nSharedStates = trajectory != nullptr ? trajectory->size() : 0;
+    auto discardSharedStates = [&]() {
+      if (trajectory != nullptr) {
+        trajectory->truncate(nSharedStates);
+      }
+    };
+
     // Run the fitter
     auto result = m_propagator.template propagate(sParameters, kalmanOptions);
 
     if (!result.ok()) {
+      discardSharedStates();
       return result.error();
     }
 
-    const auto& propRes = *result;
+    auto& propRes = *result;
 
     /// Get the result of the fit
-    auto kalmanResult = propRes.template get<KalmanResult>();
+    auto kalmanResult = std::move(propRes.template get<KalmanResult>());
 
     /// It could happen that the fit ends in zero processed states.
     /// The result gets meaningless so such case is regarded as fit failure.
@@ -998,6 +1033,7 @@ class KalmanFitter {
     }
 
     if (!kalmanResult.result.ok()) {
+      discardSharedStates();
       return kalmanResult.result.error();
     }
 
@@ -1005,6 +1041,47 @@ class KalmanFitter {
     return m_outputConverter(std::move(kalmanResult));
   }
 
+  /// Fit a batch of independent tracks, optionally concurrently
+  ///
+  /// @tparam source_link_t Source link type identifying uncalibrated input
+  /// measurements.
+  /// @tparam start_parameters_t Type of the initial parameters
+  /// @tparam kalman_fitter_options_t Type of the kalman fitter options
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements of each track
+  /// @param sParameters The initial track parameters of each track
+  /// @param kfOptions KalmanOptions steering all fits
+  /// @param nThreads The maximal number of concurrent fits, 1 fits the
+  /// tracks sequentially
+  /// @note Each fit runs with its own propagation state, i.e. stepper,
+  /// navigator and magnetic field cache, on one thread. The results are
+  /// identical to fitting the tracks one by one.
+  ///
+  /// @return the fit results in the order of the input tracks
+  template <typename source_link_t, typename start_parameters_t,
+            typename kalman_fitter_options_t,
+            typename parameters_t = BoundParameters,
+            typename result_t = Result<KalmanFitterResult<source_link_t>>>
+  auto fitBatch(const std::vector<std::vector<source_link_t>>& sourcelinks,
+                const std::vector<start_parameters_t>& sParameters,
+                const kalman_fitter_options_t& kfOptions,
+                size_t nThreads = 1) const
+      -> std::enable_if_t<!isDirectNavigator, std::vector<result_t>> {
+    if (sourcelinks.size() != sParameters.size()) {
+      throw std::invalid_argument(
+          "Number of source link sets and start parameters differ");
+    }
+    ACTS_DEBUG("Fitting " << sourcelinks.size() << " tracks with up to "
+                          << nThreads << " threads");
+    return detail::parallelMap(
+        sourcelinks.size(), nThreads, [&](size_t itrack) -> result_t {
+          return fit<source_link_t, start_parameters_t,
+                     kalman_fitter_options_t, parameters_t, result_t>(
+              sourcelinks[itrack], sParameters[itrack], kfOptions);
+        });
+  }
+
   /// Fit implementation of the foward filter, calls the
   /// the forward filter and backward smoother
   ///
@@ -1018,6 +1095,9 @@ class KalmanFitter {
   /// @param sParameters The initial track parameters
   /// @param kfOptions KalmanOptions steering the fit
   /// @param sSequence surface sequence used to initialize a DirectNavigator
+  /// @param trajectory Optional trajectory shared with other fits, e.g. of
+  /// the same event, to which the track states are appended. The result then
+  /// only holds the index of the track tip in this trajectory.
   /// @note The input measurements are given in the form of @c SourceLinks. It's
   /// @c calibrator_t's job to turn them into calibrated measurements used in
   /// the fit.
@@ -1030,7 +1110,8 @@ class KalmanFitter {
   auto fit(const std::vector<source_link_t>& sourcelinks,
            const start_parameters_t& sParameters,
            const kalman_fitter_options_t& kfOptions,
-           const std::vector<const Surface*>& sSequence) const
+           const std::vector<const Surface*>& sSequence,
+           MultiTrajectory<source_link_t>* trajectory = nullptr) const
       -> std::enable_if_t<isDirectNavigator, result_t> {
     static_assert(SourceLinkConcept<source_link_t>,
                   "Source link does not fulfill SourceLinkConcept");
@@ -1041,14 +1122,10 @@ class KalmanFitter {
         "Inconsistent type of outlier finder between kalman fitter and "
         "kalman fitter options");
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
+    // To be able to find measurements later, we index them by surface. The
+    // source links are only referenced, they outlive the propagation.
     ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
-    std::map<const Surface*, source_link_t> inputMeasurements;
-    for (const auto& sl : sourcelinks) {
-      const Surface* srf = &sl.referenceSurface();
-      inputMeasurements.emplace(srf, sl);
-    }
+    detail::SourceLinkLookup<source_link_t> inputMeasurements(sourcelinks);
 
     // Create the ActionList and AbortList
     using KalmanAborter = Aborter<source_link_t, parameters_t>;
@@ -1069,6 +1146,7 @@ class KalmanFitter {
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
     kalmanActor.backwardFiltering = kfOptions.backwardFiltering;
+    kalmanActor.sharedStates = trajectory;
 
     // Set config for outlier finder
     kalmanActor.m_outlierFinder.m_config = kfOptions.outlierFinderConfig;
@@ -1082,17 +1160,26 @@ class KalmanFitter {
         kalmanOptions.actionList.template get<DirectNavigator::Initializer>();
     dInitializer.surfaceSequence = sSequence;
 
+    // The states of a failed fit are removed from the shared trajectory
+    const size_t nSharedStates = trajectory != nullptr ? trajectory->size() : 0;
+    auto discardSharedStates = [&]() {
+      if (trajectory != nullptr) {
+        trajectory->truncate(nSharedStates);
+      }
+    };
+
     // Run the fitter
     auto result = m_propagator.template propagate(sParameters, kalmanOptions);
 
     if (!result.ok()) {
+      discardSharedStates();
       return result.error();
     }
 
-    const auto& propRes = *result;
+    auto& propRes = *result;
 
     /// Get the result of the fit
-    auto kalmanResult = propRes.template get<KalmanResult>();
+    auto kalmanResult = std::move(propRes.template get<KalmanResult>());
 
     /// It could happen that the fit ends in zero processed states.
     /// The result gets meaningless so such case is regarded as fit failure.
@@ -1101,6 +1188,7 @@ class KalmanFitter {
     }
 
     if (!kalmanResult.result.ok()) {
+      discardSharedStates();
       return kalmanResult.result.error();
     }
 
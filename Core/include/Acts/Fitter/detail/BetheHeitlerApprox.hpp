@@ -0,0 +1,115 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Acts {
+namespace detail {
+
+/// A component of the Bethe-Heitler mixture, describing the fraction
+/// @f$ z = E_{after} / E_{before} @f$ of the energy kept by an electron
+struct BetheHeitlerComponent {
+  double weight = 1.;
+  double mean = 1.;
+  double variance = 0.;
+};
+
+/// @brief Gaussian mixture approximation of the Bethe-Heitler distribution
+///
+/// The energy fraction @f$ z @f$ kept by an electron traversing material of
+/// thickness @f$ t @f$ in units of the radiation length follows
+/// @f$ z = e^{-u} @f$, with @f$ u @f$ gamma distributed with shape
+/// @f$ c = t / \ln 2 @f$. This is the same model as used for the simulation
+/// in ActsFatras::BetheHeitler.
+///
+/// The distribution is split into components of equal weight by the
+/// quantiles of @f$ u @f$, and each component is the Gaussian with the
+/// mean and variance of @f$ z @f$ within its quantile range. These follow
+/// in closed form from the regularised incomplete gamma function, since
+/// @f$ \int_a^b e^{-ku} u^{c-1} e^{-u} du / \Gamma(c) =
+/// (k+1)^{-c} (P(c, (k+1) b) - P(c, (k+1) a)) @f$. The moments of the
+/// mixture are those of the Bethe-Heitler distribution.
+struct BetheHeitlerApprox {
+  /// Maximum number of components
+  static constexpr size_t kMaxComponents = 8;
+
+  /// Container for the components of the mixture
+  using Mixture =
+      boost::container::small_vector<BetheHeitlerComponent, kMaxComponents>;
+
+  /// Number of components of the mixture
+  size_t nComponents = 6;
+
+  /// Below this thickness (in X0) the energy loss is neglected
+  double minThicknessInX0 = 1e-4;
+
+  /// Approximate the Bethe-Heitler distribution for a material slab
+  ///
+  /// @param thicknessInX0 The traversed thickness in units of X0
+  ///
+  /// @return the components, with weights summing up to one
+  Mixture mixture(double thicknessInX0) const {
+    Mixture components;
+    const size_t n = std::min(std::max<size_t>(nComponents, 1), kMaxComponents);
+    if (thicknessInX0 < minThicknessInX0 or n == 1) {
+      components.push_back({1., 1., 0.});
+      if (thicknessInX0 >= minThicknessInX0) {
+        // single component with the mean and variance of z
+        const double c = thicknessInX0 / std::log(2.);
+        const double mean = std::pow(2., -c);
+        components.front().mean = mean;
+        components.front().variance = std::pow(3., -c) - mean * mean;
+      }
+      return components;
+    }
+
+    using boost::math::gamma_p;
+    using boost::math::gamma_p_inv;
+    const double c = thicknessInX0 / std::log(2.);
+    const double norm2 = std::pow(2., -c);
+    const double norm3 = std::pow(3., -c);
+    const double weight = 1. / n;
+    // the integrals up to the lower quantile of u
+    double p2Lower = 0.;
+    double p3Lower = 0.;
+    for (size_t ic = 0; ic < n; ++ic) {
+      double p2Upper = 1.;
+      double p3Upper = 1.;
+      if (ic + 1 < n) {
+        const double quantile = (ic + 1) * weight;
+        const double upper = gamma_p_inv(c, quantile);
+        if (upper < 1e-8) {
+          // P(c, k u) = k^c P(c, u) for small u, which avoids the loss of
+          // precision for thin material
+          p2Upper = quantile / norm2;
+          p3Upper = quantile / norm3;
+        } else {
+          p2Upper = gamma_p(c, 2. * upper);
+          p3Upper = gamma_p(c, 3. * upper);
+        }
+      }
+      // conditional moments of z within the quantile range
+      const double mean = std::min(norm2 * (p2Upper - p2Lower) / weight, 1.);
+      const double meanSquare = norm3 * (p3Upper - p3Lower) / weight;
+      components.push_back(
+          {weight, mean, std::max(meanSquare - mean * mean, 0.)});
+      p2Lower = p2Upper;
+      p3Lower = p3Upper;
+    }
+    return components;
+  }
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -0,0 +1,141 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+namespace detail {
+
+/// A weighted Gaussian component of the track parameters on a surface
+struct GaussianComponent {
+  double weight = 1.;
+  BoundVector parameters = BoundVector::Zero();
+  BoundSymMatrix covariance = BoundSymMatrix::Zero();
+};
+
+using GaussianMixture = std::vector<GaussianComponent>;
+
+/// Normalise the weights of the mixture to a sum of one
+///
+/// @param mixture The mixture with positive total weight
+inline void normalizeWeights(GaussianMixture& mixture) {
+  double sumWeights = 0.;
+  for (const auto& cmp : mixture) {
+    sumWeights += cmp.weight;
+  }
+  for (auto& cmp : mixture) {
+    cmp.weight /= sumWeights;
+  }
+}
+
+/// Remove the components below a weight cutoff and renormalise
+///
+/// The component with the highest weight is always kept, such that the
+/// mixture never becomes empty, even if the cutoff is above 1 / size.
+///
+/// @param mixture The non-empty mixture with normalised weights
+/// @param weightCutoff The minimal weight of the kept components
+inline void removeLowWeights(GaussianMixture& mixture, double weightCutoff) {
+  auto best = std::max_element(
+      mixture.begin(), mixture.end(),
+      [](const auto& a, const auto& b) { return a.weight < b.weight; });
+  if (best == mixture.end()) {
+    return;
+  }
+  const double cutoff = std::min(weightCutoff, best->weight);
+  mixture.erase(
+      std::remove_if(mixture.begin(), mixture.end(),
+                     [&](const auto& cmp) { return cmp.weight < cutoff; }),
+      mixture.end());
+  normalizeWeights(mixture);
+}
+
+/// Merge a component into another one, preserving the mean and covariance
+/// of the pair
+///
+/// @param a The component to merge into
+/// @param b The component to merge
+inline void mergeComponents(GaussianComponent& a, const GaussianComponent& b) {
+  const double weight = a.weight + b.weight;
+  const double wa = a.weight / weight;
+  const double wb = b.weight / weight;
+  const BoundVector diff = a.parameters - b.parameters;
+  a.parameters = wa * a.parameters + wb * b.parameters;
+  a.covariance = wa * a.covariance + wb * b.covariance +
+                 (wa * wb) * diff * diff.transpose();
+  a.weight = weight;
+}
+
+/// Collapse the mixture into a single Gaussian with its mean and covariance
+///
+/// @param mixture The mixture with normalised weights
+///
+/// @return the mean and covariance of the mixture
+inline std::pair<BoundVector, BoundSymMatrix> collapse(
+    const GaussianMixture& mixture) {
+  BoundVector mean = BoundVector::Zero();
+  for (const auto& cmp : mixture) {
+    mean += cmp.weight * cmp.parameters;
+  }
+  BoundSymMatrix covariance = BoundSymMatrix::Zero();
+  for (const auto& cmp : mixture) {
+    const BoundVector diff = cmp.parameters - mean;
+    covariance += cmp.weight * (cmp.covariance + diff * diff.transpose());
+  }
+  return {mean, covariance};
+}
+
+/// @brief Reduce the mixture to a maximum number of components
+///
+/// The components are ordered by q/p, along which the mixture is spread by
+/// the energy loss. Neighbouring components are merged pairwise, each time
+/// the pair whose merging adds the least spread in q/p, i.e. with the
+/// smallest @f$ w_a w_b / (w_a + w_b) (q/p_a - q/p_b)^2 @f$. This needs no
+/// matrix operations to find the pairs and keeps the mean and covariance of
+/// the mixture unchanged.
+///
+/// @param mixture The mixture to reduce
+/// @param maxComponents The maximum number of components to keep
+inline void reduceMixture(GaussianMixture& mixture, size_t maxComponents) {
+  if (mixture.size() <= maxComponents) {
+    return;
+  }
+  std::sort(mixture.begin(), mixture.end(), [](const auto& a, const auto& b) {
+    return a.parameters[eQOP] < b.parameters[eQOP];
+  });
+  auto cost = [&](size_t i) {
+    const auto& a = mixture[i];
+    const auto& b = mixture[i + 1];
+    const double dqop = a.parameters[eQOP] - b.parameters[eQOP];
+    return a.weight * b.weight / (a.weight + b.weight) * dqop * dqop;
+  };
+  while (mixture.size() > std::max<size_t>(maxComponents, 1)) {
+    size_t best = 0;
+    double bestCost = cost(0);
+    for (size_t i = 1; i + 1 < mixture.size(); ++i) {
+      const double c = cost(i);
+      if (c < bestCost) {
+        best = i;
+        bestCost = c;
+      }
+    }
+    // the merged component stays between its neighbours in q/p
+    mergeComponents(mixture[best], mixture[best + 1]);
+    mixture.erase(mixture.begin() + best + 1);
+  }
+}
+
+}  // namespace detail
+}  // namespace Acts
@@ -0,0 +1,84 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Eigen/Cholesky>
+
+namespace Acts {
+namespace detail {
+
+/// @brief Smoothing gain @f$ G_k = F_k J_{k+1}^T P_{k+1}^{-1} @f$ through
+/// the inverse of the predicted covariance @f$ P_{k+1} @f$
+///
+/// @tparam covariance_t Type of the covariance and gain matrix
+template <typename covariance_t>
+struct InverseSmoothingGain {
+  /// @param filteredCovariance The filtered covariance @f$ F_k @f$
+  /// @param jacobian The jacobian @f$ J_{k+1} @f$ to the next state
+  /// @param predictedCovariance The predicted covariance @f$ P_{k+1} @f$
+  /// @param [out] gain The smoothing gain
+  ///
+  /// @return false if the gain could not be computed
+  template <typename filtered_t, typename jacobian_t, typename predicted_t>
+  bool operator()(const filtered_t& filteredCovariance,
+                  const jacobian_t& jacobian,
+                  const predicted_t& predictedCovariance,
+                  covariance_t& gain) const {
+    gain = filteredCovariance * jacobian.transpose() *
+           predictedCovariance.inverse();
+    return not gain.hasNaN();
+  }
+};
+
+/// @brief Smoothing gain from the linear system
+/// @f$ P_{k+1} G_k^T = J_{k+1} F_k @f$, which is solved with a Cholesky
+/// decomposition of the predicted covariance @f$ P_{k+1} @f$
+///
+/// If the predicted covariance is only positive semi-definite, e.g. because
+/// a parameter is known exactly and has vanishing variance, a robust LDLT
+/// decomposition is used instead. Its vanishing pivots give a vanishing
+/// gain, i.e. exactly known parameters are not changed by the smoothing.
+/// The decompositions are allocated once and reused for all track states.
+///
+/// @tparam covariance_t Type of the covariance and gain matrix
+template <typename covariance_t>
+class CholeskySmoothingGain {
+ public:
+  /// @param filteredCovariance The filtered covariance @f$ F_k @f$
+  /// @param jacobian The jacobian @f$ J_{k+1} @f$ to the next state
+  /// @param predictedCovariance The predicted covariance @f$ P_{k+1} @f$
+  /// @param [out] gain The smoothing gain
+  ///
+  /// @return false if the gain could not be computed
+  template <typename filtered_t, typename jacobian_t, typename predicted_t>
+  bool operator()(const filtered_t& filteredCovariance,
+                  const jacobian_t& jacobian,
+                  const predicted_t& predictedCovariance, covariance_t& gain) {
+    // Right hand side J F, using that both covariances are symmetric
+    const covariance_t JF = jacobian * filteredCovariance;
+    m_llt.compute(predictedCovariance);
+    if (m_llt.info() == Eigen::Success) {
+      gain = m_llt.solve(JF).transpose();
+    } else {
+      m_ldlt.compute(predictedCovariance);
+      if (m_ldlt.info() != Eigen::Success) {
+        return false;
+      }
+      gain = m_ldlt.solve(JF).transpose();
+    }
+    return not gain.hasNaN();
+  }
+
+ private:
+  Eigen::LLT<covariance_t> m_llt{covariance_t::RowsAtCompileTime};
+  Eigen::LDLT<covariance_t> m_ldlt{covariance_t::RowsAtCompileTime};
+};
+
+}  // namespace detail
+}  // namespace Acts
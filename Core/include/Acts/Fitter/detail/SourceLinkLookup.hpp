@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+namespace detail {
+
+/// @brief flat lookup of the source links of a track by their surface
+///
+/// @tparam source_link_t Type of the source links
+///
+/// The lookup stores the surfaces together with the index of the source link
+/// in the input container, sorted by surface, and finds them by binary
+/// search. Storage for the typical number of measurements of a track is kept
+/// in place, such that building the lookup for a fit does not allocate.
+/// Several source links on the same surface, e.g. the candidates of a track
+/// search, are kept in the order of the input container.
+///
+/// @note The source link container must outlive the lookup
+template <typename source_link_t>
+class SourceLinkLookup {
+ public:
+  /// Number of entries stored without allocation
+  static constexpr size_t kInplaceEntries = 32;
+  /// Number of source links per surface returned without allocation
+  static constexpr size_t kInplaceCandidates = 8;
+
+  /// Container for the source links on a surface
+  using Candidates =
+      boost::container::small_vector<const source_link_t*, kInplaceCandidates>;
+
+  /// Default constructor for an empty lookup
+  SourceLinkLookup() = default;
+
+  /// Constructor from source links
+  ///
+  /// @param sourcelinks The source links
+  SourceLinkLookup(const std::vector<source_link_t>& sourcelinks)
+      : m_sourcelinks(&sourcelinks) {
+    m_entries.reserve(sourcelinks.size());
+    for (size_t isl = 0; isl < sourcelinks.size(); ++isl) {
+      m_entries.emplace_back(&sourcelinks[isl].referenceSurface(),
+                             static_cast<uint32_t>(isl));
+    }
+    // sorting by surface and index keeps the input order on each surface
+    std::sort(m_entries.begin(), m_entries.end());
+    for (size_t ie = 0; ie < m_entries.size(); ++ie) {
+      if (ie == 0 or m_entries[ie].first != m_entries[ie - 1].first) {
+        ++m_nSurfaces;
+      }
+    }
+  }
+
+  /// Find the source link on a surface
+  ///
+  /// @param surface The surface to look for
+  ///
+  /// @return pointer to the first source link on the surface, nullptr if
+  ///         there is none
+  const source_link_t* find(const Surface* surface) const {
+    auto it = lowerBound(surface);
+    if (it == m_entries.end() or it->first != surface) {
+      return nullptr;
+    }
+    return &(*m_sourcelinks)[it->second];
+  }
+
+  /// Find all source links on a surface
+  ///
+  /// @param surface The surface to look for
+  ///
+  /// @return pointers to the source links on the surface, empty if there
+  ///         are none
+  Candidates findAll(const Surface* surface) const {
+    Candidates candidates;
+    for (auto it = lowerBound(surface);
+         it != m_entries.end() and it->first == surface; ++it) {
+      candidates.push_back(&(*m_sourcelinks)[it->second]);
+    }
+    return candidates;
+  }
+
+  /// Number of surfaces with source links
+  size_t size() const { return m_nSurfaces; }
+
+ private:
+  using Entry = std::pair<const Surface*, uint32_t>;
+
+  /// The source links
+  const std::vector<source_link_t>* m_sourcelinks = nullptr;
+
+  /// The surfaces with the index of their source link, sorted by surface
+  boost::container::small_vector<Entry, kInplaceEntries> m_entries;
+
+  /// Number of distinct surfaces
+  size_t m_nSurfaces = 0;
+
+  /// First entry on the surface or the one following it
+  auto lowerBound(const Surface* surface) const {
+    return std::lower_bound(
+        m_entries.begin(), m_entries.end(), surface,
+        [](const Entry& entry, const Surface* s) { return entry.first < s; });
+  }
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -0,0 +1,67 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include "Acts/Geometry/DetectorElementBase.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+namespace Acts {
+
+class PlanarBounds;
+class Surface;
+
+/// @class AlignedDetectorElement
+///
+/// Reference detector element for a planar module that takes its aligned
+/// transform from the AlignmentStore of the geometry context, keyed by the
+/// geometry identifier of its surface. The nominal transform is used if the
+/// context carries no store or the store does not contain the element.
+class AlignedDetectorElement : public DetectorElementBase {
+ public:
+  AlignedDetectorElement() = delete;
+
+  /// Constructor for a planar detector element
+  ///
+  /// @param transform The nominal transform of the element
+  /// @param pBounds The planar bounds of the element surface
+  /// @param thickness The module thickness
+  AlignedDetectorElement(std::shared_ptr<const Transform3D> transform,
+                         std::shared_ptr<const PlanarBounds> pBounds,
+                         double thickness);
+
+  ~AlignedDetectorElement() override = default;
+
+  /// Return the aligned transform of the element
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  ///
+  /// @note this is called from the surface().transform() in the PROXY mode
+  const Transform3D& transform(const GeometryContext& gctx) const override;
+
+  /// Return the nominal transform of the element
+  const Transform3D& nominalTransform() const { return *m_nominalTransform; }
+
+  /// Return surface associated with this detector element
+  const Surface& surface() const override { return *m_surface; }
+
+  /// The maximal thickness of the detector element wrt normal axis
+  double thickness() const override { return m_thickness; }
+
+ private:
+  /// The nominal transform
+  std::shared_ptr<const Transform3D> m_nominalTransform;
+  /// The surface represented by the element
+  std::shared_ptr<const Surface> m_surface;
+  /// The element thickness
+  double m_thickness = 0.;
+};
+
+}  // namespace Acts
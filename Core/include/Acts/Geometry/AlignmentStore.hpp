@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/detail/GeometryIDIndex.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+namespace Acts {
+
+/// @class AlignmentStore
+///
+/// Immutable, versioned set of aligned transforms, e.g. for one interval of
+/// validity. The transforms are stored contiguously in the order of their
+/// geometry identifiers and are looked up in constant time.
+///
+/// A store is never modified once it is created, hence it can be shared
+/// between any number of concurrent events without locking. Switching the
+/// alignment means handing out a context with a different store, see
+/// AlignmentProvider.
+class AlignmentStore {
+ public:
+  /// Identifier & transform pair as input
+  using Entry = std::pair<GeometryID, Transform3D>;
+
+  /// Constructor from identifier & transform pairs
+  ///
+  /// @param entries The aligned transforms, in any order
+  /// @param version The version of this alignment set, e.g. the IOV
+  ///
+  /// @note throws std::invalid_argument for duplicate identifiers
+  AlignmentStore(std::vector<Entry> entries, size_t version = 0);
+
+  /// The version of this alignment set
+  size_t version() const { return m_version; }
+
+  /// Number of aligned transforms
+  size_t size() const { return m_transforms.size(); }
+
+  /// The identifiers, sorted
+  const std::vector<GeometryID>& ids() const { return m_index.ids(); }
+
+  /// The aligned transforms, in the order of the identifiers
+  const std::vector<Transform3D>& transforms() const { return m_transforms; }
+
+  /// Aligned transform for an identifier
+  ///
+  /// @param geoID The geometry identifier
+  ///
+  /// @return pointer to the transform, nullptr if not aligned
+  const Transform3D* transform(const GeometryID& geoID) const {
+    uint32_t position = m_index.find(geoID);
+    return (position == detail::GeometryIDIndex::npos)
+               ? nullptr
+               : &m_transforms[position];
+  }
+
+ private:
+  /// The version number
+  size_t m_version = 0;
+  /// The identifier lookup
+  detail::GeometryIDIndex m_index;
+  /// The transforms, in the order of the identifiers
+  std::vector<Transform3D> m_transforms;
+};
+
+/// @struct AlignmentContext
+///
+/// GeometryContext payload pointing into an AlignmentStore
+struct AlignmentContext {
+  /// The alignment store, nullptr for the nominal geometry
+  std::shared_ptr<const AlignmentStore> store = nullptr;
+
+  /// Find the alignment store of a geometry context
+  ///
+  /// @param gctx The geometry context to be inspected
+  ///
+  /// @return the store or nullptr if the context does not point to one
+  static const AlignmentStore* find(const GeometryContext& gctx) {
+#ifdef ACTS_CORE_GEOMETRYCONTEXT_PLUGIN
+    (void)gctx;
+    return nullptr;
+#else
+    auto payload = std::any_cast<AlignmentContext>(&gctx);
+    return (payload != nullptr) ? payload->store.get() : nullptr;
+#endif
+  }
+};
+
+/// @class AlignmentProvider
+///
+/// Holds the current alignment store. Updating the store is atomic, and
+/// contexts created before the update keep their store alive, so events
+/// in flight finish with the alignment they started with.
+class AlignmentProvider {
+ public:
+  /// Constructor
+  ///
+  /// @param store The initial store, nullptr for the nominal geometry
+  AlignmentProvider(std::shared_ptr<const AlignmentStore> store = nullptr)
+      : m_store(std::move(store)) {}
+
+  /// Atomically replace the current store
+  ///
+  /// @param store The new store
+  void update(std::shared_ptr<const AlignmentStore> store) {
+    std::atomic_store(&m_store, std::move(store));
+  }
+
+  /// Atomically read the current store
+  std::shared_ptr<const AlignmentStore> store() const {
+    return std::atomic_load(&m_store);
+  }
+
+#ifndef ACTS_CORE_GEOMETRYCONTEXT_PLUGIN
+  /// Geometry context pointing to the current store
+  GeometryContext context() const { return AlignmentContext{store()}; }
+#endif
+
+ private:
+  std::shared_ptr<const AlignmentStore> m_store;
+};
+
+}  // namespace Acts
@@ -124,6 +124,22 @@ class BoundarySurfaceT {
   /// The Surface Representation of this
   virtual const Surface& surfaceRepresentation() const;
 
+  /// The single inside volume, nullptr if not set
+  const T* volumeInside() const { return m_insideVolume; }
+
+  /// The single outside volume, nullptr if not set
+  const T* volumeOutside() const { return m_outsideVolume; }
+
+  /// The inside volume array, nullptr if not set
+  const std::shared_ptr<const VolumeArray>& volumeArrayInside() const {
+    return m_insideVolumeArray;
+  }
+
+  /// The outside volume array, nullptr if not set
+  const std::shared_ptr<const VolumeArray>& volumeArrayOutside() const {
+    return m_outsideVolumeArray;
+  }
+
   /// Virtual Destructor
   virtual ~BoundarySurfaceT() = default;
 
@@ -506,6 +506,13 @@ class CylinderVolumeBuilder : public ITrackingVolumeBuilder {
 
     /// Volume signature
     int volumeSignature = -1;
+
+    /// Number of concurrent tasks to build the negative, central and
+    /// positive layers and the sub volumes, 1 builds sequentially.
+    /// @note Only set this larger than 1 if the layer builder and the
+    ///       tracking volume helper are safe for concurrent calls, see
+    ///       ILayerBuilder and ITrackingVolumeHelper.
+    size_t nThreads = 1;
   };
 
   /// Constructor
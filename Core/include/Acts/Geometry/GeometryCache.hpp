@@ -0,0 +1,115 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/detail/GeometryIDIndex.hpp"
+#include "Acts/Geometry/detail/TransformColumns.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+namespace Acts {
+
+class Surface;
+class TrackingGeometry;
+
+/// @class GeometryCache
+///
+/// Contextual transforms and their inverse of all sensitive surfaces of a
+/// TrackingGeometry, evaluated once for a given GeometryContext and stored
+/// contiguously. The rotation matrix and the normal vector of a surface are
+/// the linear part and its third column of the cached transform. The
+/// transforms are also stored as structure-of-arrays columns for the batched
+/// intersection of many surfaces, e.g. through the NavigationOptions.
+///
+/// The cache is opt-in: it is handed explicitly to the code that should use
+/// it, and the GeometryContext itself is left untouched, such that detector
+/// elements and user code keep finding their alignment payload in it.
+/// Surfaces that are not cached are always taken from their contextual
+/// transform. The cache must only be used together with the context it was
+/// evaluated for.
+class GeometryCache {
+ public:
+  /// Slot index for surfaces that are not cached
+  static constexpr uint32_t npos = detail::GeometryIDIndex::npos;
+
+  /// Constructor, evaluates all sensitive surface transforms
+  ///
+  /// @param gctx The geometry context to be cached, e.g. alignment
+  /// @param tGeometry The tracking geometry with the sensitive surfaces
+  /// @param nThreads The number of threads used to evaluate the transforms
+  GeometryCache(const GeometryContext& gctx, const TrackingGeometry& tGeometry,
+                size_t nThreads = 1);
+
+  /// Constructor from a list of surfaces, evaluates their transforms
+  ///
+  /// @param gctx The geometry context to be cached, e.g. alignment
+  /// @param surfaces The surfaces, those without sensitive identifier are
+  ///        skipped, identifiers must be unique
+  /// @param nThreads The number of threads used to evaluate the transforms
+  GeometryCache(const GeometryContext& gctx,
+                std::vector<const Surface*> surfaces, size_t nThreads = 1);
+
+  GeometryCache(const GeometryCache&) = delete;
+  GeometryCache& operator=(const GeometryCache&) = delete;
+
+  /// Number of cached surfaces
+  size_t size() const { return m_surfaces.size(); }
+
+  /// Slot of a surface in the cache
+  ///
+  /// @param surface The surface to be looked up
+  ///
+  /// @return the slot or npos if the surface is not cached
+  uint32_t slot(const Surface& surface) const;
+
+  /// Cached surface for a given slot
+  ///
+  /// @param islot The slot, must be smaller than size()
+  const Surface* surface(uint32_t islot) const { return m_surfaces[islot]; }
+
+  /// Cached transform of a surface
+  ///
+  /// @param surface The surface to be looked up
+  ///
+  /// @return pointer to the transform, nullptr if not cached
+  const Transform3D* transform(const Surface& surface) const {
+    uint32_t islot = slot(surface);
+    return (islot == npos) ? nullptr : &m_transforms[islot];
+  }
+
+  /// Cached inverse transform of a surface
+  ///
+  /// @param surface The surface to be looked up
+  ///
+  /// @return pointer to the inverse transform, nullptr if not cached
+  const Transform3D* inverseTransform(const Surface& surface) const {
+    uint32_t islot = slot(surface);
+    return (islot == npos) ? nullptr : &m_inverseTransforms[islot];
+  }
+
+  /// Cached transforms as columns, indexed by slot
+  const detail::TransformColumns& columns() const { return m_columns; }
+
+ private:
+  /// The cached surfaces, ordered by geometry identifier
+  std::vector<const Surface*> m_surfaces;
+  /// The contextual transforms, one per surface
+  std::vector<Transform3D> m_transforms;
+  /// The inverse contextual transforms, one per surface
+  std::vector<Transform3D> m_inverseTransforms;
+  /// The contextual transforms as columns, one entry per surface
+  detail::TransformColumns m_columns;
+  /// The slot lookup by identifier
+  detail::GeometryIDIndex m_index;
+};
+
+}  // namespace Acts
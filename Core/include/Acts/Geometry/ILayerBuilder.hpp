@@ -28,6 +28,11 @@ using LayerVector = std::vector<LayerPtr>;
 /// | EC- | Central | EC+ |
 /// detector setup.
 ///
+/// @note The CylinderVolumeBuilder calls the negativeLayers, centralLayers
+///       and positiveLayers methods concurrently if it is configured with
+///       more than one thread. Implementations used in this way must be
+///       safe for concurrent calls, i.e. must not modify shared state
+///       without synchronisation. The default configuration is sequential.
 class ILayerBuilder {
  public:
   /// Virtual destructor
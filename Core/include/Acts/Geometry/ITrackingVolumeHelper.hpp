@@ -40,6 +40,10 @@ using MutableTrackingVolumeVector = std::vector<MutableTrackingVolumePtr>;
 /// The ITrackingVolumeHelper is a tool to pack a set of layers into a volume,
 /// or - to wrap several volumes into a container volume.
 ///
+/// @note The CylinderVolumeBuilder creates the barrel and endcap volumes
+///       concurrently if it is configured with more than one thread, which
+///       requires the helper to be safe for concurrent calls.
+///
 /// @todo add documentation how this is done
 ///
 /// TrackingVolumes only exist as std::shared_ptr
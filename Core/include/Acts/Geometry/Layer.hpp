@@ -21,6 +21,7 @@
 #include "Acts/Geometry/GeometryObject.hpp"
 #include "Acts/Geometry/GeometryStatics.hpp"
 #include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
 #include "Acts/Utilities/Definitions.hpp"
@@ -106,6 +107,10 @@ class Layer : public virtual GeometryObject {
   /// Non-const version
   SurfaceArray* surfaceArray();
 
+  /// Return the batched planar sensitive surfaces, which are intersected in
+  /// one go by compatibleSurfaces(), empty before the geometry is closed
+  const PlaneSurfaceBatch& sensitiveBatch() const;
+
   /// Transforms the layer into a Surface representation for extrapolation
   /// @note the layer can be hosting many surfaces, but this is the global
   /// one to which one can extrapolate
@@ -250,6 +255,10 @@ class Layer : public virtual GeometryObject {
   ///
   std::unique_ptr<const SurfaceArray> m_surfaceArray = nullptr;
 
+  /// Batched planar sensitive surfaces for the intersection in
+  /// compatibleSurfaces(), filled when the geometry is closed
+  PlaneSurfaceBatch m_sensitiveBatch;
+
   /// Thickness of the Layer
   double m_layerThickness = 0.;
 
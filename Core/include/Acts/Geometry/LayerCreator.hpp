@@ -18,6 +18,7 @@
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/detail/ParallelMap.hpp"
 
 #include <optional>
 
@@ -199,6 +200,27 @@ class LayerCreator {
       std::shared_ptr<const Transform3D> transform = nullptr,
       std::unique_ptr<ApproachDescriptor> ad = nullptr) const;
 
+  /// Create a set of independent layers, optionally concurrently
+  ///
+  /// @param nLayers is the number of layers to be created
+  /// @param createLayer is the callable creating the layer with a given
+  /// index, e.g. by calling cylinderLayer() or discLayer() of this creator
+  /// @param nThreads is the maximal number of concurrent tasks, 1 creates the
+  /// layers sequentially
+  ///
+  /// @note the layer creation methods may be called concurrently for
+  /// disjoint sets of surfaces
+  ///
+  /// @return the layers in index order, independent of the scheduling, so the
+  /// geometry identifiers assigned at closure are the same
+  template <typename layer_factory_t>
+  std::vector<MutableLayerPtr> createLayers(size_t nLayers,
+                                            layer_factory_t&& createLayer,
+                                            size_t nThreads = 1) const {
+    return detail::parallelMap(nLayers, nThreads,
+                               std::forward<layer_factory_t>(createLayer));
+  }
+
   /// Set the configuration object
   /// @param lcConfig is the configuration struct
   void setConfiguration(const Config& lcConfig);
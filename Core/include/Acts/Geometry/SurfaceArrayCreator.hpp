@@ -221,6 +221,33 @@ class SurfaceArrayCreator {
       std::optional<ProtoLayer> protoLayerOpt = std::nullopt,
       const std::shared_ptr<const Transform3D>& transformOpt = nullptr) const;
 
+  /// SurfaceArrayCreator interface method
+  /// - create an array with a known binning and bin content, e.g. when
+  /// restoring a stored geometry, no surface positions are evaluated
+  ///
+  /// The local coordinates follow the binning values of the axes:
+  /// (binPhi, binZ) on a cylinder, (binR, binPhi) on a disc, and the local
+  /// (x, y) of the transform on a plane otherwise.
+  ///
+  /// @param [in] gctx The gometry context fro this building call
+  /// @param [in] surfaces is the vector of pointers to sensitive surfaces
+  /// @param [in] pAxisA is the first axis of the grid
+  /// @param [in] pAxisB is the second axis of the grid
+  /// @param [in] binContent are the indices into @p surfaces for every
+  /// global bin, including under- and overflow bins
+  /// @param [in] layerValue is the radius (cylinder) or the z position (disc)
+  /// used for the bin centers
+  /// @param [in] transformOpt is the (optional) additional transform applied
+  ///
+  /// @return a unique pointer a new SurfaceArray
+  std::unique_ptr<SurfaceArray> surfaceArrayOnGrid(
+      const GeometryContext& gctx,
+      std::vector<std::shared_ptr<const Surface>> surfaces,
+      const ProtoAxis& pAxisA, const ProtoAxis& pAxisB,
+      const std::vector<std::vector<size_t>>& binContent,
+      double layerValue = 0.,
+      const std::shared_ptr<const Transform3D>& transformOpt = nullptr) const;
+
   /// Static check funtion for surface equivalent
   ///
   /// @param [in] gctx the geometry context for this check
@@ -14,8 +14,10 @@
 
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/detail/GeometryIDIndex.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <array>
 #include <functional>
 #include <map>
 #include <memory>
@@ -105,13 +107,71 @@ class TrackingGeometry {
   void visitSurfaces(
       const std::function<void(const Acts::Surface*)>& visitor) const;
 
+  /// Find a surface by its geometry identifier
+  ///
+  /// Covers boundary, layer, approach and sensitive surfaces. The lookup
+  /// uses a flat index built when the geometry is closed.
+  ///
+  /// @param geoID The geometry identifier of the surface
+  ///
+  /// @return plain pointer to the surface, nullptr if not found
+  const Surface* findSurface(GeometryID geoID) const;
+
+  /// Find a layer by its geometry identifier
+  ///
+  /// @param geoID The geometry identifier of the layer
+  ///
+  /// @return plain pointer to the layer, nullptr if not found
+  const Layer* findLayer(GeometryID geoID) const;
+
+  /// Find a volume by its geometry identifier
+  ///
+  /// @param geoID The geometry identifier of the volume
+  ///
+  /// @return plain pointer to the volume, nullptr if not found
+  const TrackingVolume* findVolume(GeometryID geoID) const;
+
+  /// All identified surfaces, in the order of their identifiers
+  const std::vector<const Surface*>& surfaces() const;
+
  private:
+  /// Build the flat point-location index used by lowestTrackingVolume
+  ///
+  /// The world extent is divided into a regular grid. Every cell stores the
+  /// deepest volume in the hierarchy which confines all volumes that are
+  /// touching the cell, the search then only has to descend from there.
+  void buildVolumeLookup();
+
+  /// Build the flat geometry identifier indices for surfaces, layers and
+  /// volumes
+  void buildGeometryIDIndex();
+
   /// The known world - and the beamline
   TrackingVolumePtr m_world;
   std::shared_ptr<const PerigeeSurface> m_beam;
 
   /// The Volumes in a map for string based search
   std::map<std::string, const TrackingVolume*> m_trackingVolumes;
+
+  /// Flat point-location grid: start volumes for the hierarchical search,
+  /// immutable after construction and therefore safe for concurrent access
+  std::vector<const TrackingVolume*> m_volumeLookup;
+  /// Lower corner of the point-location grid
+  Vector3D m_lookupMin = Vector3D::Zero();
+  /// Inverse cell size of the point-location grid
+  Vector3D m_lookupInvCellSize = Vector3D::Zero();
+  /// Number of cells of the point-location grid along x, y, z
+  std::array<size_t, 3> m_lookupBins = {{0, 0, 0}};
+
+  /// Identifier lookup and surfaces in the order of their identifiers
+  detail::GeometryIDIndex m_surfaceIndex;
+  std::vector<const Surface*> m_surfaces;
+  /// Identifier lookup and layers in the order of their identifiers
+  detail::GeometryIDIndex m_layerIndex;
+  std::vector<const Layer*> m_layers;
+  /// Identifier lookup and volumes in the order of their identifiers
+  detail::GeometryIDIndex m_volumeIndex;
+  std::vector<const TrackingVolume*> m_volumes;
 };
 
 }  // namespace Acts
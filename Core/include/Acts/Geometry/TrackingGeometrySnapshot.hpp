@@ -0,0 +1,117 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+namespace Acts {
+
+class DetectorElementBase;
+class TrackingGeometry;
+
+/// @class TrackingGeometrySnapshot
+///
+/// Binary snapshot of a closed TrackingGeometry: the volume hierarchy with
+/// its bounds and boundary surfaces, the layers with their approach
+/// surfaces and surface arrays, all surfaces with their bounds and
+/// GeometryIDs, as well as the surface and volume material.
+///
+/// The snapshot is a header with a section table followed by sections of
+/// fixed-size records, which reference each other by index and share pools
+/// of doubles, indices and characters. It is read with plain copies, hence
+/// the buffer handed to read() can also be a memory mapped file.
+///
+/// Restoring a geometry skips the building and binning of the surfaces
+/// entirely: the surface arrays are refilled from the stored bin content,
+/// and the GeometryIDs assigned during the closure of the restored geometry
+/// are checked against the stored ones.
+///
+/// @note Sensitive surfaces are owned by their detector elements, these
+///       are provided by the detectorElementResolver. Surfaces without a
+///       resolved element are restored as free surfaces with the nominal
+///       transform at the time of writing.
+/// @note Glue volume descriptors and bounding volume hierarchies are not
+///       part of the snapshot, geometries with the latter are rejected.
+class TrackingGeometrySnapshot {
+ public:
+  /// Function to find the detector element of a sensitive surface
+  using DetectorElementResolver =
+      std::function<const DetectorElementBase*(const GeometryID&)>;
+
+  /// @struct Config
+  /// Configuration for the TrackingGeometrySnapshot
+  struct Config {
+    /// Resolver for the detector elements of the sensitive surfaces
+    DetectorElementResolver detectorElementResolver = nullptr;
+  };
+
+  /// Constructor
+  ///
+  /// @param cfg The configuration struct
+  /// @param logger The logging instance
+  TrackingGeometrySnapshot(const Config& cfg,
+                           std::unique_ptr<const Logger> logger =
+                               getDefaultLogger("TrackingGeometrySnapshot",
+                                                Logging::INFO));
+
+  /// Write the snapshot of a tracking geometry
+  ///
+  /// @param gctx The geometry context for the surface transforms
+  /// @param tGeometry The closed tracking geometry
+  ///
+  /// @return the binary snapshot
+  std::vector<char> write(const GeometryContext& gctx,
+                          const TrackingGeometry& tGeometry) const;
+
+  /// Write the snapshot of a tracking geometry to a file
+  ///
+  /// @param gctx The geometry context for the surface transforms
+  /// @param tGeometry The closed tracking geometry
+  /// @param fileName The name of the output file
+  void writeFile(const GeometryContext& gctx, const TrackingGeometry& tGeometry,
+                 const std::string& fileName) const;
+
+  /// Restore a tracking geometry from a snapshot
+  ///
+  /// @param gctx The geometry context for the construction
+  /// @param data The start of the binary snapshot
+  /// @param size The size of the binary snapshot
+  ///
+  /// @return the restored and closed tracking geometry
+  std::unique_ptr<const TrackingGeometry> read(const GeometryContext& gctx,
+                                               const char* data,
+                                               size_t size) const;
+
+  /// Restore a tracking geometry from a snapshot file
+  ///
+  /// @param gctx The geometry context for the construction
+  /// @param fileName The name of the input file
+  ///
+  /// @return the restored and closed tracking geometry
+  std::unique_ptr<const TrackingGeometry> readFile(
+      const GeometryContext& gctx, const std::string& fileName) const;
+
+ private:
+  /// Private access to the logger
+  const Logger& logger() const { return *m_logger; }
+
+  /// The configuration
+  Config m_cfg;
+
+  /// The logging instance
+  std::unique_ptr<const Logger> m_logger;
+};
+
+}  // namespace Acts
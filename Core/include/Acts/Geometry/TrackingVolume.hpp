@@ -24,6 +24,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
 #include "Acts/Utilities/BoundingBox.hpp"
+#include "Acts/Utilities/FlatBoundingBoxHierarchy.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Frustum.hpp"
 #include "Acts/Utilities/Ray.hpp"
@@ -335,6 +336,10 @@ class TrackingVolume : public Volume {
   /// @return If it has a BVH or not.
   bool hasBoundingVolumeHierarchy() const;
 
+  /// Return the descendant volumes of the BoundingVolumeHierarchy
+  /// @return the volumes, empty if there is no hierarchy
+  const std::vector<std::unique_ptr<const Volume>>& descendantVolumes() const;
+
   /// Register the color code
   ///
   /// @param icolor is a color number
@@ -424,8 +429,7 @@ class TrackingVolume : public Volume {
   void interlinkLayers();
 
   template <typename T>
-  static std::vector<const Volume*> intersectSearchHierarchy(
-      const T obj, const Volume::BoundingBox* lnode);
+  std::vector<const Volume*> intersectSearchHierarchy(const T obj) const;
 
   /// The volume based material the TrackingVolume consists of
   std::shared_ptr<const IVolumeMaterial> m_volumeMaterial{nullptr};
@@ -459,6 +463,8 @@ class TrackingVolume : public Volume {
   std::vector<std::unique_ptr<const Volume::BoundingBox>> m_boundingBoxes;
   std::vector<std::unique_ptr<const Volume>> m_descendantVolumes;
   const Volume::BoundingBox* m_bvhTop{nullptr};
+  /// Linearised copy of the hierarchy used for the traversal
+  FlatBoundingBoxHierarchy<Volume::BoundingBox> m_bvhFlat;
 };
 
 inline const std::string& TrackingVolume::volumeName() const {
@@ -512,6 +518,11 @@ inline bool TrackingVolume::hasBoundingVolumeHierarchy() const {
   return m_bvhTop != nullptr;
 }
 
+inline const std::vector<std::unique_ptr<const Volume>>&
+TrackingVolume::descendantVolumes() const {
+  return m_descendantVolumes;
+}
+
 #include "detail/TrackingVolume.ipp"
 
 }  // namespace Acts
\ No newline at end of file
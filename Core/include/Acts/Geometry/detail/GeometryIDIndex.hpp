@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "Acts/Geometry/GeometryID.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @class GeometryIDIndex
+///
+/// Maps a sorted list of geometry identifiers to their position in the
+/// list in constant time.
+///
+/// The identifiers are binned in a flat (volume, layer) table, every table
+/// entry points to a dense block covering the range of sensitive numbers
+/// found in this layer. Identifiers that do not fit this scheme, e.g.
+/// several approach or boundary surfaces of the same layer, are found
+/// through a binary search instead.
+class GeometryIDIndex {
+ public:
+  /// Position for identifiers not contained in the list
+  static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+  /// Default constructor, creates an empty index
+  GeometryIDIndex() = default;
+
+  /// Constructor from a sorted list of unique identifiers
+  ///
+  /// @param ids The sorted identifiers
+  explicit GeometryIDIndex(std::vector<GeometryID> ids)
+      : m_ids(std::move(ids)) {
+    if (m_ids.size() >= npos) {
+      throw std::length_error("Too many identifiers for the index");
+    }
+    GeometryID::Value nVolumes = 0;
+    for (const auto& id : m_ids) {
+      nVolumes = std::max(nVolumes, id.volume() + 1);
+      m_layerStride = std::max(m_layerStride, id.layer() + 1);
+    }
+    m_layers.assign(nVolumes * m_layerStride, Block());
+    // the sensitive range per layer
+    for (const auto& id : m_ids) {
+      Block& block = m_layers[id.volume() * m_layerStride + id.layer()];
+      GeometryID::Value sensitive = id.sensitive();
+      if (block.count == 0) {
+        block.first = sensitive;
+        block.last = sensitive;
+      }
+      block.first = std::min(block.first, sensitive);
+      block.last = std::max(block.last, sensitive);
+      ++block.count;
+    }
+    // the dense blocks, sparse layers are left to the binary search
+    for (auto& block : m_layers) {
+      block.offset = m_positions.size();
+      block.size = (block.count == 0) ? 0 : block.last - block.first + 1;
+      if (block.size > 2 * block.count + 64) {
+        block.size = 0;
+      }
+      m_positions.resize(m_positions.size() + block.size, npos);
+    }
+    for (size_t ip = 0; ip < m_ids.size(); ++ip) {
+      const GeometryID& id = m_ids[ip];
+      const Block& block = m_layers[id.volume() * m_layerStride + id.layer()];
+      if (block.size == 0) {
+        continue;
+      }
+      uint32_t& position =
+          m_positions[block.offset + id.sensitive() - block.first];
+      // first come first served, others are found by the binary search
+      if (position == npos) {
+        position = static_cast<uint32_t>(ip);
+      }
+    }
+  }
+
+  /// Number of identifiers
+  size_t size() const { return m_ids.size(); }
+
+  /// The sorted identifiers
+  const std::vector<GeometryID>& ids() const { return m_ids; }
+
+  /// Position of an identifier in the sorted list
+  ///
+  /// @param id The identifier to be looked up
+  ///
+  /// @return the position or npos if the identifier is not contained
+  uint32_t find(GeometryID id) const {
+    GeometryID::Value layer = id.layer();
+    GeometryID::Value cell = id.volume() * m_layerStride + layer;
+    if (layer < m_layerStride and cell < m_layers.size()) {
+      const Block& block = m_layers[cell];
+      GeometryID::Value sensitive = id.sensitive();
+      if (sensitive >= block.first and sensitive - block.first < block.size) {
+        uint32_t position =
+            m_positions[block.offset + sensitive - block.first];
+        if (position != npos and m_ids[position] == id) {
+          return position;
+        }
+      }
+    }
+    // not in the dense table, e.g. approach surfaces of the same layer
+    auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id);
+    return (it != m_ids.end() and *it == id)
+               ? static_cast<uint32_t>(it - m_ids.begin())
+               : npos;
+  }
+
+ private:
+  /// Dense block of the sensitive numbers of one layer
+  struct Block {
+    size_t offset = 0;
+    GeometryID::Value first = 0;
+    GeometryID::Value last = 0;
+    GeometryID::Value size = 0;
+    size_t count = 0;
+  };
+
+  /// The sorted identifiers
+  std::vector<GeometryID> m_ids;
+  /// The blocks per (volume, layer), flattened as volume * stride + layer
+  std::vector<Block> m_layers;
+  /// Number of layer entries per volume
+  GeometryID::Value m_layerStride = 0;
+  /// Positions in the identifier list, npos for holes
+  std::vector<uint32_t> m_positions;
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <limits>
 
 namespace Acts {
@@ -18,6 +19,10 @@ inline SurfaceArray* Layer::surfaceArray() {
   return const_cast<SurfaceArray*>(m_surfaceArray.get());
 }
 
+inline const PlaneSurfaceBatch& Layer::sensitiveBatch() const {
+  return m_sensitiveBatch;
+}
+
 inline double Layer::thickness() const {
   return m_layerThickness;
 }
@@ -131,20 +136,15 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     return options.resolvePassive;
   };
 
-  // lemma 1 : check and fill the surface
-  // [&sIntersections, &options, &parameters
-  auto processSurface = [&](const Surface& sf, bool sensitive = false) {
-    // veto if it's start or end surface
-    if (options.startObject == &sf || options.endObject == &sf) {
-      return;
-    }
-    // veto if it doesn't fit the prescription
-    if (!acceptSurface(sf, sensitive)) {
-      return;
-    }
-    // the surface intersection
-    SurfaceIntersection sfi = sf.intersect(
-        gctx, position, options.navDir * direction, options.boundaryCheck);
+  // lemma 1 : veto if it's start or end surface or doesn't fit the
+  // prescription
+  auto vetoSurface = [&](const Surface& sf, bool sensitive = false) -> bool {
+    return (options.startObject == &sf || options.endObject == &sf ||
+            !acceptSurface(sf, sensitive));
+  };
+
+  // lemma 2 : check the intersection and fill the surface
+  auto fillSurface = [&](SurfaceIntersection sfi) {
     // check if intersection is valid and pathLimit has not been exceeded
     double sifPath = sfi.intersection.pathLength;
     // check the maximum path length
@@ -153,9 +153,19 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
       // Now put the right sign on it
       sfi.intersection.pathLength *= std::copysign(1., options.navDir);
       sIntersections.push_back(sfi);
-      accepted[&sf] = true;
+      accepted[sfi.object] = true;
     }
-    return;
+  };
+
+  // lemma 3 : check and fill the surface
+  // [&sIntersections, &options, &parameters
+  auto processSurface = [&](const Surface& sf, bool sensitive = false) {
+    if (vetoSurface(sf, sensitive)) {
+      return;
+    }
+    // the surface intersection
+    fillSurface(sf.intersect(gctx, position, options.navDir * direction,
+                             options.boundaryCheck));
   };
 
   // (A) approach descriptor section
@@ -182,13 +192,38 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   if (m_surfaceArray && (options.resolveMaterial || options.resolvePassive ||
                          options.resolveSensitive)) {
     // get the canditates
-    const std::vector<const Surface*>& sensitiveSurfaces =
-        m_surfaceArray->neighbors(position);
+    SurfaceRange sensitiveSurfaces = m_surfaceArray->neighbors(position);
+    // batched planar surfaces are collected & intersected in one go
+    const bool batched = !m_sensitiveBatch.empty() &&
+                         m_sensitiveBatch.supports(options.boundaryCheck);
+    std::vector<size_t> batchSlots;
+    if (batched) {
+      batchSlots.reserve(sensitiveSurfaces.size());
+    }
     // loop through and veto
     // - if the approach surface is the parameter surface
     // - if the surface is not compatible with the type(s) that are collected
     for (auto& sSurface : sensitiveSurfaces) {
-      processSurface(*sSurface, true);
+      size_t slot =
+          batched ? m_sensitiveBatch.slot(sSurface) : PlaneSurfaceBatch::npos;
+      if (slot == PlaneSurfaceBatch::npos) {
+        processSurface(*sSurface, true);
+      } else if (!vetoSurface(*sSurface, true)) {
+        // registered right away, which vetoes duplicates in the candidates
+        accepted[sSurface] = false;
+        batchSlots.push_back(slot);
+      }
+    }
+    if (!batchSlots.empty()) {
+      std::vector<Intersection> batchIntersections;
+      m_sensitiveBatch.intersect(gctx, position, options.navDir * direction,
+                                 options.boundaryCheck, batchSlots,
+                                 batchIntersections, options.geometryCache);
+      for (size_t is = 0; is < batchSlots.size(); ++is) {
+        fillSurface(SurfaceIntersection(
+            batchIntersections[is],
+            &m_sensitiveBatch.surface(batchSlots[is])));
+      }
     }
   }
 
@@ -189,10 +189,10 @@ TrackingVolume::compatibleSurfacesFromHierarchy(
   if (angle == 0) {
     // use ray
     Ray3D obj(position, sdir);
-    hits = intersectSearchHierarchy(std::move(obj), m_bvhTop);
+    hits = intersectSearchHierarchy(std::move(obj));
   } else {
     Acts::Frustum<double, 3, 4> obj(position, sdir, angle);
-    hits = intersectSearchHierarchy(std::move(obj), m_bvhTop);
+    hits = intersectSearchHierarchy(std::move(obj));
   }
 
   // have cells, decompose to surfaces
@@ -224,29 +224,16 @@ TrackingVolume::compatibleSurfacesFromHierarchy(
 
 template <typename T>
 std::vector<const Volume*> TrackingVolume::intersectSearchHierarchy(
-    const T obj, const Volume::BoundingBox* lnode) {
+    const T obj) const {
   std::vector<const Volume*> hits;
   hits.reserve(20);  // arbitrary
-  do {
-    if (lnode->intersect(obj)) {
-      if (lnode->hasEntity()) {
-        // found primitive
-        // check obb to limit false positivies
-        const Volume* vol = lnode->entity();
-        const auto& obb = vol->orientedBoundingBox();
-        if (obb.intersect(obj.transformed(vol->itransform()))) {
-          hits.push_back(vol);
-        }
-        // we skip in any case, whether we actually hit the OBB or not
-        lnode = lnode->getSkip();
-      } else {
-        // go over children
-        lnode = lnode->getLeftChild();
-      }
-    } else {
-      lnode = lnode->getSkip();
+  for (const Volume* vol : m_bvhFlat.intersect(obj)) {
+    // check obb to limit false positivies
+    const auto& obb = vol->orientedBoundingBox();
+    if (obb.intersect(obj.transformed(vol->itransform()))) {
+      hits.push_back(vol);
     }
-  } while (lnode != nullptr);
+  }
 
   return hits;
 }
@@ -0,0 +1,67 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <vector>
+#include "Acts/Utilities/Definitions.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @struct TransformColumns
+///
+/// Structure-of-arrays copy of a list of placement transforms: the
+/// translation and the three local axes, one array per coordinate, such
+/// that loops over many placements read contiguous memory.
+struct TransformColumns {
+  /// Number of stored transforms
+  size_t size() const { return cx.size(); }
+
+  /// Resize all columns, new entries are zero
+  ///
+  /// @param n The new number of transforms
+  void resize(size_t n) {
+    for (auto* column : {&cx, &cy, &cz, &ux, &uy, &uz, &vx, &vy, &vz, &nx,
+                         &ny, &nz}) {
+      column->resize(n, 0.);
+    }
+  }
+
+  /// Store a transform
+  ///
+  /// @param i The index to be written, must be smaller than size()
+  /// @param transform The transform to be stored
+  void set(size_t i, const Transform3D& transform) {
+    const auto& tMatrix = transform.matrix();
+    ux[i] = tMatrix(0, 0);
+    uy[i] = tMatrix(1, 0);
+    uz[i] = tMatrix(2, 0);
+    vx[i] = tMatrix(0, 1);
+    vy[i] = tMatrix(1, 1);
+    vz[i] = tMatrix(2, 1);
+    nx[i] = tMatrix(0, 2);
+    ny[i] = tMatrix(1, 2);
+    nz[i] = tMatrix(2, 2);
+    cx[i] = tMatrix(0, 3);
+    cy[i] = tMatrix(1, 3);
+    cz[i] = tMatrix(2, 3);
+  }
+
+  /// Centre, i.e. the translation
+  std::vector<double> cx, cy, cz;
+  /// Local x axis, i.e. the first rotation column
+  std::vector<double> ux, uy, uz;
+  /// Local y axis, i.e. the second rotation column
+  std::vector<double> vx, vy, vz;
+  /// Normal vector, i.e. the third rotation column
+  std::vector<double> nx, ny, nz;
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -8,12 +8,14 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <optional>
 #include <vector>
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
 namespace Acts {
@@ -109,6 +111,40 @@ struct InterpolatedBFieldMapper {
     std::array<Vector3D, N> m_fieldValues;
   };
 
+  /// @brief grid cell for the computation of the field gradient
+  ///
+  /// This type holds the field values at the corners of a grid cell in the
+  /// frame of the field map, together with the cell edges, such that the
+  /// grid look-up can be reused while the position stays inside the cell.
+  struct FieldGradientCell {
+    /// number of corner points defining the confining hyper-box
+    static constexpr unsigned int N = 1 << DIM_POS;
+
+    /// @brief check whether given grid position is inside this cell
+    ///
+    /// @param [in] gridPosition position in grid coordinates
+    /// @return @c true if position is inside the cell, otherwise @c false
+    bool isInside(const ActsVectorD<DIM_POS>& gridPosition) const {
+      for (unsigned int i = 0; i < DIM_POS; ++i) {
+        if (gridPosition[i] < lowerLeft[i] or
+            gridPosition[i] >= upperRight[i]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /// generalized lower-left corner of the confining hyper-box
+    std::array<double, DIM_POS> lowerLeft;
+    /// generalized upper-right corner of the confining hyper-box
+    std::array<double, DIM_POS> upperRight;
+    /// inverse widths of the hyper-box along each dimension
+    std::array<double, DIM_POS> invWidth;
+    /// field values at the hyper-box corners in the frame of the map, sorted
+    /// in the canonical order defined in Acts::interpolate
+    std::array<FieldType, N> values;
+  };
+
   /// @brief default constructor
   ///
   /// @param [in] transformPos mapping of global 3D coordinates (cartesian)
@@ -138,6 +174,136 @@ struct InterpolatedBFieldMapper {
                              position);
   }
 
+  /// @brief retrieve field and its gradient at given position
+  ///
+  /// @param [in]  position   global 3D position
+  /// @param [out] derivative gradient of the magnetic field with
+  ///                         @c derivative(i,j) = dB_i / dx_j
+  /// @return magnetic field value at the given position
+  ///
+  /// @pre The given @c position must lie within the range of the underlying
+  ///      magnetic field map.
+  Vector3D getFieldGradient(const Vector3D& position,
+                            ActsMatrixD<3, 3>& derivative) const {
+    std::optional<FieldGradientCell> cell;
+    return getFieldGradient(position, derivative, cell);
+  }
+
+  /// @brief retrieve field and its gradient at given position
+  ///
+  /// @param [in]  position   global 3D position
+  /// @param [out] derivative gradient of the magnetic field with
+  ///                         @c derivative(i,j) = dB_i / dx_j
+  /// @param [in,out] cell    grid cell of the previous call, which is
+  ///                         replaced if it does not contain @p position
+  /// @return magnetic field value at the given position
+  ///
+  /// The field value and its derivatives with respect to the grid
+  /// coordinates are obtained in a single pass over the cell corners from
+  /// the multi-linear interpolation weights. The gradient in global
+  /// coordinates follows from the chain rule through both transformations:
+  /// the jacobian of the position transformation maps the grid derivatives
+  /// onto global coordinates, and the explicit position dependence of the
+  /// field transformation (e.g. the rotation of an (r,z) field into the
+  /// global frame) is added. Both terms are obtained together from central
+  /// differences of the transformations of the linearised field, no
+  /// additional field look-ups are needed.
+  ///
+  /// @note The field transformation is assumed to be linear in the field
+  ///       values, as it is for the usual rotations into the global frame.
+  ///
+  /// @pre The given @c position must lie within the range of the underlying
+  ///      magnetic field map.
+  Vector3D getFieldGradient(const Vector3D& position,
+                            ActsMatrixD<3, 3>& derivative,
+                            std::optional<FieldGradientCell>& cell) const {
+    const ActsVectorD<DIM_POS> gridPosition = m_transformPos(position);
+    if (!cell || !(*cell).isInside(gridPosition)) {
+      cell = getFieldGradientCell(gridPosition);
+    }
+    const FieldGradientCell& c = *cell;
+
+    // normalized position inside the cell
+    std::array<double, DIM_POS> t;
+    for (size_t i = 0; i < DIM_POS; ++i) {
+      t[i] = (gridPosition[i] - c.lowerLeft[i]) * c.invWidth[i];
+    }
+
+    // field value and derivatives w.r.t. the grid coordinates
+    constexpr size_t DIM_BFIELD = FieldType::RowsAtCompileTime;
+    FieldType field = FieldType::Zero();
+    ActsMatrixD<DIM_BFIELD, DIM_POS> gridDerivative =
+        ActsMatrixD<DIM_BFIELD, DIM_POS>::Zero();
+    for (unsigned int corner = 0; corner < FieldGradientCell::N; ++corner) {
+      const FieldType& value = c.values[corner];
+      // the left most bit of the corner number refers to the first axis
+      std::array<double, DIM_POS> w;
+      std::array<double, DIM_POS> dw;
+      for (size_t i = 0; i < DIM_POS; ++i) {
+        const bool upper = (corner >> (DIM_POS - 1 - i)) & 1u;
+        w[i] = upper ? t[i] : 1. - t[i];
+        dw[i] = upper ? c.invWidth[i] : -c.invWidth[i];
+      }
+      double weight = 1.;
+      for (size_t i = 0; i < DIM_POS; ++i) {
+        weight *= w[i];
+      }
+      field += weight * value;
+      for (size_t i = 0; i < DIM_POS; ++i) {
+        double dweight = dw[i];
+        for (size_t j = 0; j < DIM_POS; ++j) {
+          if (j != i) {
+            dweight *= w[j];
+          }
+        }
+        gridDerivative.col(i) += dweight * value;
+      }
+    }
+
+    // Central differences of the transformed, linearised field. As the
+    // field transformation is linear in the field values, this yields the
+    // mapped grid derivatives plus the explicit position dependence of the
+    // field transformation.
+    constexpr double h = 1e-4;
+    for (size_t j = 0; j < 3; ++j) {
+      Vector3D step = Vector3D::Zero();
+      step[j] = h;
+      const Vector3D forward = position + step;
+      const Vector3D backward = position - step;
+      const FieldType forwardField =
+          field + gridDerivative * (m_transformPos(forward) - gridPosition);
+      const FieldType backwardField =
+          field + gridDerivative * (m_transformPos(backward) - gridPosition);
+      derivative.col(j) = (m_transformBField(forwardField, forward) -
+                           m_transformBField(backwardField, backward)) /
+                          (2. * h);
+    }
+    return m_transformBField(field, position);
+  }
+
+  /// @brief retrieve grid cell for the field gradient at given position
+  ///
+  /// @param [in] gridPosition position in grid coordinates
+  /// @return grid cell containing the given position
+  ///
+  /// @pre The given @c gridPosition must lie within the range of the
+  ///      underlying magnetic field map.
+  FieldGradientCell getFieldGradientCell(
+      const ActsVectorD<DIM_POS>& gridPosition) const {
+    const auto& indices = m_grid.localBinsFromPosition(gridPosition);
+    FieldGradientCell cell;
+    cell.lowerLeft = m_grid.lowerLeftBinEdge(indices);
+    cell.upperRight = m_grid.upperRightBinEdge(indices);
+    for (size_t i = 0; i < DIM_POS; ++i) {
+      cell.invWidth[i] = 1. / (cell.upperRight[i] - cell.lowerLeft[i]);
+    }
+    size_t corner = 0;
+    for (size_t index : m_grid.closestPointsIndices(gridPosition)) {
+      cell.values[corner++] = m_grid.at(index);
+    }
+    return cell;
+  }
+
   /// @brief retrieve field cell for given position
   ///
   /// @param [in] position global 3D position
@@ -214,6 +380,16 @@ struct InterpolatedBFieldMapper {
   Grid_t m_grid;
 };
 
+namespace concept {
+  namespace BFieldMapper {
+  /// Optional method of the mapper providing the field gradient
+  METHOD_TRAIT(field_gradient_t, getFieldGradient);
+  /// Optional grid cell of the mapper for cached field gradients
+  template <typename T>
+  using field_gradient_cell_t = typename T::FieldGradientCell;
+  }  // namespace BFieldMapper
+}  // namespace concept
+
 /// @ingroup MagneticField
 /// @brief interpolate magnetic field value from field values on a given grid
 ///
@@ -250,6 +426,13 @@ class InterpolatedBFieldMap final {
     Mapper_t mapper;
   };
 
+  /// Placeholder for mappers without a cached field gradient
+  struct NoFieldGradientCell {};
+  /// Grid cell of the mapper for the cached field gradient
+  using FieldGradientCell = typename concept::detected_or<
+      NoFieldGradientCell, concept::BFieldMapper::field_gradient_cell_t,
+      Mapper_t>::type;
+
   struct Cache {
     /// @brief Constructor with magnetic field context
     ///
@@ -257,6 +440,8 @@ class InterpolatedBFieldMap final {
     Cache(std::reference_wrapper<const MagneticFieldContext> /*mcfg*/) {}
 
     std::optional<typename Mapper_t::FieldCell> fieldCell;
+    /// grid cell of the last field gradient
+    std::optional<FieldGradientCell> gradientCell;
     bool initialized = false;
   };
 
@@ -297,29 +482,49 @@ class InterpolatedBFieldMap final {
   ///
   /// @param [in]  position   global 3D position
   /// @param [out] derivative gradient of magnetic field vector as (3x3) matrix
+  ///                         with @c derivative(i,j) = dB_i / dx_j
   /// @return magnetic field vector
   ///
-  /// @note currently the derivative is not calculated
-  /// @todo return derivative
+  /// @note The gradient is computed analytically from the interpolation
+  ///       coefficients if the mapper provides @c getFieldGradient.
+  ///       Otherwise only the field is returned and @p derivative is left
+  ///       unchanged.
   Vector3D getFieldGradient(const Vector3D& position,
-                            ActsMatrixD<3, 3>& /*derivative*/) const {
-    return m_config.mapper.getField(position);
+                            ActsMatrixD<3, 3>& derivative) const {
+    if constexpr (concept::has_method<const Mapper_t, Vector3D,
+                                      concept::BFieldMapper::field_gradient_t,
+                                      const Vector3D&, ActsMatrixD<3, 3>&>) {
+      return m_config.mapper.getFieldGradient(position, derivative);
+    } else {
+      return m_config.mapper.getField(position);
+    }
   }
 
   /// @brief retrieve magnetic field value & its gradient
   ///
   /// @param [in]  position   global 3D position
   /// @param [out] derivative gradient of magnetic field vector as (3x3) matrix
+  ///                         with @c derivative(i,j) = dB_i / dx_j
   /// @param [in,out] cache Cache object. Contains field cell used for
+  /// interpolation
   /// @return magnetic field vector
   ///
-  /// @note currently the derivative is not calculated
-  /// @note Cache is not used currently
-  /// @todo return derivative
+  /// @note The field cell of the cache holds the field values already
+  ///       transformed into the global frame, the gradient is therefore
+  ///       computed from a separate grid cell of the cache, which is reused
+  ///       while the position stays inside of it.
   Vector3D getFieldGradient(const Vector3D& position,
-                            ActsMatrixD<3, 3>& /*derivative*/,
-                            Cache& /*cache*/) const {
-    return m_config.mapper.getField(position);
+                            ActsMatrixD<3, 3>& derivative,
+                            Cache& cache) const {
+    if constexpr (concept::has_method<const Mapper_t, Vector3D,
+                                      concept::BFieldMapper::field_gradient_t,
+                                      const Vector3D&, ActsMatrixD<3, 3>&,
+                                      std::optional<FieldGradientCell>&>) {
+      return m_config.mapper.getFieldGradient(position, derivative,
+                                              cache.gradientCell);
+    } else {
+      return getFieldGradient(position, derivative);
+    }
   }
 
   /// @brief get global scaling factor for magnetic field
@@ -26,6 +26,8 @@ namespace Acts {
 
 using namespace Acts::UnitLiterals;
 
+class GeometryCache;
+
 /// @brief struct for the Navigation options that are forwarded to
 ///        the geometry
 ///
@@ -63,6 +65,10 @@ struct NavigationOptions {
   /// @todo could be dynamic in the future (pT dependent)
   double overstepLimit = -1_um;
 
+  /// Optional cache of the sensitive surface placements
+  /// @note must be evaluated for the context of the navigation
+  const GeometryCache* geometryCache = nullptr;
+
   /// Constructor
   ///
   /// @param nDir Navigation direction prescription
@@ -152,6 +158,11 @@ class Navigator {
   /// stop at every surface regardless what it is
   bool resolvePassive = false;
 
+  /// Optional cache of the sensitive surface placements, used for the
+  /// batched surface intersection on layers
+  /// @note must be evaluated for the geometry context of the propagation
+  const GeometryCache* geometryCache = nullptr;
+
   /// Nested State struct
   ///
   /// It acts as an internal state which is
@@ -1080,6 +1091,7 @@ class Navigator {
     NavigationOptions<Surface> navOpts(
         state.stepping.navDir, true, resolveSensitive, resolveMaterial,
         resolvePassive, startSurface, state.navigation.targetSurface);
+    navOpts.geometryCache = geometryCache;
     // Check the limit
     navOpts.pathLimit = state.stepping.stepSize.value(ConstrainedStep::aborter);
     // No overstepping on start layer, otherwise ask the stepper
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <vector>
+#include <boost/container/static_vector.hpp>
 #include "Acts/Seeding/SpacePointGrid.hpp"
 
 namespace Acts {
@@ -21,6 +21,9 @@ namespace Acts {
 template <typename external_spacepoint_t>
 class BinFinder {
  public:
+  /// Global bin indices of a neighborhood, at most three bins in phi and z
+  using bin_indices_t = boost::container::static_vector<size_t, 9>;
+
   /// destructor
   ~BinFinder() = default;
 
@@ -29,9 +32,9 @@ class BinFinder {
   /// @param phiBin phi index of bin with middle space points
   /// @param zBin z index of bin with middle space points
   /// @param binnedSP phi-z grid containing all bins
-  std::vector<size_t> findBins(
-      size_t phiBin, size_t zBin,
-      const SpacePointGrid<external_spacepoint_t>* binnedSP);
+  /// @note The indices are stored on the stack, no memory is allocated.
+  bin_indices_t findBins(size_t phiBin, size_t zBin,
+                         const SpacePointGrid<external_spacepoint_t>* binnedSP);
 };
 }  // namespace Acts
 #include "Acts/Seeding/BinFinder.ipp"
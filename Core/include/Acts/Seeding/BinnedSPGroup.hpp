@@ -22,38 +22,42 @@ namespace Acts {
 ///@class NeighborhooodIterator Iterates over the elements of all bins given
 /// by the indices parameter in the given SpacePointGrid.
 /// Fullfills the forward iterator.
+/// The bin indices are owned by the Neighborhood the iterator belongs to,
+/// copying the iterator does not copy them.
 template <typename external_spacepoint_t>
 class NeighborhoodIterator {
  public:
   using sp_it_t = typename std::vector<std::unique_ptr<
       const InternalSpacePoint<external_spacepoint_t>>>::const_iterator;
+  using bin_indices_t =
+      typename BinFinder<external_spacepoint_t>::bin_indices_t;
 
   NeighborhoodIterator() = delete;
 
-  NeighborhoodIterator(std::vector<size_t> indices,
+  NeighborhoodIterator(const bin_indices_t* indices,
                        const SpacePointGrid<external_spacepoint_t>* spgrid) {
     m_grid = spgrid;
     m_indices = indices;
     m_curInd = 0;
-    if (m_indices.size() > m_curInd) {
-      m_curIt = std::begin(spgrid->at(m_indices[m_curInd]));
-      m_binEnd = std::end(spgrid->at(m_indices[m_curInd]));
+    if (m_indices->size() > m_curInd) {
+      m_curIt = std::begin(spgrid->at((*m_indices)[m_curInd]));
+      m_binEnd = std::end(spgrid->at((*m_indices)[m_curInd]));
     }
   }
 
-  NeighborhoodIterator(std::vector<size_t> indices,
+  NeighborhoodIterator(const bin_indices_t* indices,
                        const SpacePointGrid<external_spacepoint_t>* spgrid,
                        size_t curInd, sp_it_t curIt) {
     m_grid = spgrid;
     m_indices = indices;
     m_curInd = curInd;
     m_curIt = curIt;
-    if (m_indices.size() > m_curInd) {
-      m_binEnd = std::end(spgrid->at(m_indices[m_curInd]));
+    if (m_indices->size() > m_curInd) {
+      m_binEnd = std::end(spgrid->at((*m_indices)[m_curInd]));
     }
   }
   static NeighborhoodIterator<external_spacepoint_t> begin(
-      std::vector<size_t> indices,
+      const bin_indices_t* indices,
       const SpacePointGrid<external_spacepoint_t>* spgrid) {
     auto nIt = NeighborhoodIterator<external_spacepoint_t>(indices, spgrid);
     // advance until first non-empty bin or last bin
@@ -63,15 +67,6 @@ class NeighborhoodIterator {
     return nIt;
   }
 
-  NeighborhoodIterator(
-      const NeighborhoodIterator<external_spacepoint_t>& other) {
-    m_grid = other.m_grid;
-    m_indices = other.m_indices;
-    m_curInd = other.m_curInd;
-    m_curIt = other.m_curIt;
-    m_binEnd = other.m_binEnd;
-  }
-
   void operator++() {
     // if iterator of current Bin not yet at end, increase
     if (m_curIt != m_binEnd) {
@@ -83,10 +78,10 @@ class NeighborhoodIterator {
     }
     // increase bin index m_curInd until you find non-empty bin
     // or until m_curInd >= m_indices.size()-1
-    while (m_curIt == m_binEnd && m_indices.size() - 1 > m_curInd) {
+    while (m_curIt == m_binEnd && m_indices->size() - 1 > m_curInd) {
       m_curInd++;
-      m_curIt = std::begin(m_grid->at(m_indices[m_curInd]));
-      m_binEnd = std::end(m_grid->at(m_indices[m_curInd]));
+      m_curIt = std::begin(m_grid->at((*m_indices)[m_curInd]));
+      m_binEnd = std::end(m_grid->at((*m_indices)[m_curInd]));
     }
   }
 
@@ -101,8 +96,8 @@ class NeighborhoodIterator {
   // iterators within current bin
   sp_it_t m_curIt;
   sp_it_t m_binEnd;
-  // number of bins
-  std::vector<size_t> m_indices;
+  // indices of the bins
+  const bin_indices_t* m_indices;
   // current bin
   size_t m_curInd;
   const Acts::SpacePointGrid<external_spacepoint_t>* m_grid;
@@ -114,24 +109,27 @@ class NeighborhoodIterator {
 template <typename external_spacepoint_t>
 class Neighborhood {
  public:
+  using bin_indices_t =
+      typename BinFinder<external_spacepoint_t>::bin_indices_t;
+
   Neighborhood() = delete;
-  Neighborhood(std::vector<size_t> indices,
+  Neighborhood(const bin_indices_t& indices,
                const SpacePointGrid<external_spacepoint_t>* spgrid) {
     m_indices = indices;
     m_spgrid = spgrid;
   }
   NeighborhoodIterator<external_spacepoint_t> begin() {
-    return NeighborhoodIterator<external_spacepoint_t>::begin(m_indices,
+    return NeighborhoodIterator<external_spacepoint_t>::begin(&m_indices,
                                                               m_spgrid);
   }
   NeighborhoodIterator<external_spacepoint_t> end() {
     return NeighborhoodIterator<external_spacepoint_t>(
-        m_indices, m_spgrid, m_indices.size() - 1,
+        &m_indices, m_spgrid, m_indices.size() - 1,
         std::end(m_spgrid->at(m_indices.back())));
   }
 
  private:
-  std::vector<size_t> m_indices;
+  bin_indices_t m_indices;
   const SpacePointGrid<external_spacepoint_t>* m_spgrid;
 };
 
@@ -150,8 +148,7 @@ class BinnedSPGroupIterator {
     }
     // set current & neighbor bins only if bin indices valid
     if (phiIndex <= phiZbins[0] && zIndex <= phiZbins[1]) {
-      currentBin =
-          std::vector<size_t>{grid->globalBinFromLocalBins({phiIndex, zIndex})};
+      currentBin = {grid->globalBinFromLocalBins({phiIndex, zIndex})};
       bottomBinIndices = m_bottomBinFinder->findBins(phiIndex, zIndex, grid);
       topBinIndices = m_topBinFinder->findBins(phiIndex, zIndex, grid);
       outputIndex++;
@@ -212,10 +209,13 @@ class BinnedSPGroupIterator {
   }
 
  private:
+  using bin_indices_t =
+      typename BinFinder<external_spacepoint_t>::bin_indices_t;
+
   // middle spacepoint bin
-  std::vector<size_t> currentBin;
-  std::vector<size_t> bottomBinIndices;
-  std::vector<size_t> topBinIndices;
+  bin_indices_t currentBin;
+  bin_indices_t bottomBinIndices;
+  bin_indices_t topBinIndices;
   const SpacePointGrid<external_spacepoint_t>* grid;
   size_t phiIndex = 1;
   size_t zIndex = 1;
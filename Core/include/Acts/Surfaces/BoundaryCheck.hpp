@@ -10,8 +10,10 @@
 #include <cfloat>
 #include <cmath>
 #include <iterator>
+#include <limits>
 #include <vector>
 
+#include "Acts/Surfaces/detail/PolygonEdges.hpp"
 #include "Acts/Surfaces/detail/VerticesHelper.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
@@ -69,6 +71,28 @@ class BoundaryCheck {
   template <typename Vector2DContainer>
   bool isInside(const Vector2D& point, const Vector2DContainer& vertices) const;
 
+  /// Check if the point is inside a convex polygon with precomputed edges.
+  ///
+  /// @param point Test point
+  /// @param edges Precomputed edges of the convex polygon
+  ///
+  /// Same result as the check against the vertices, but points far outside
+  /// of the tolerance are rejected from the distance to the edge lines.
+  bool isInside(const Vector2D& point, const detail::PolygonEdges& edges) const;
+
+  /// Check if a set of points is inside a convex polygon.
+  ///
+  /// @param points Test points
+  /// @param edges Precomputed edges of the convex polygon
+  /// @param [out] inside The check result for each point
+  ///
+  /// The edge tests are done for all points at once in loops that can be
+  /// vectorised, only points close to the polygon outside need the full
+  /// tolerance check.
+  void isInside(const std::vector<Vector2D>& points,
+                const detail::PolygonEdges& edges,
+                std::vector<bool>& inside) const;
+
   /// Check if the point is inside a box aligned with the local axes.
   ///
   /// @param point   Test point
@@ -97,6 +121,14 @@ class BoundaryCheck {
   double distance(const Vector2D& point,
                   const Vector2DContainer& vertices) const;
 
+  /// Calculate the signed, weighted, closest distance to a convex polygon.
+  ///
+  /// @param point Test point
+  /// @param edges Precomputed edges of the convex polygon
+  /// @return Negative value if inside, positive if outside
+  double distance(const Vector2D& point,
+                  const detail::PolygonEdges& edges) const;
+
   /// Calculate the signed, weighted, closest distance to an aligned box.
   ///
   /// @param point Test point
@@ -144,6 +176,13 @@ class BoundaryCheck {
   Vector2D computeClosestPointOnPolygon(
       const Vector2D& point, const Vector2DContainer& vertices) const;
 
+  /// Calculate the closest point on the polygon from precomputed edges.
+  Vector2D computeClosestPointOnPolygon(
+      const Vector2D& point, const detail::PolygonEdges& edges) const;
+
+  /// Update the quantities derived from the weight and the tolerance.
+  void updateMetric();
+
   /// Calculate the closest point on the box
   Vector2D computeEuclideanClosestPointOnRectangle(
       const Vector2D& point, const Vector2D& lowerLeft,
@@ -156,6 +195,13 @@ class BoundaryCheck {
   Vector2D m_tolerance;
   Type m_type;
 
+  /// upper triangular Cholesky factor of the weight, W = U^T U
+  ActsMatrixD<2, 2> m_cholesky = ActsMatrixD<2, 2>::Zero();
+  /// whether the weight is positive definite and the factor is valid
+  bool m_choleskyValid = false;
+  /// Euclidean distance beyond which no point is tolerated
+  double m_reach = std::numeric_limits<double>::infinity();
+
   // To acces the m_type
   friend class CylinderBounds;
   friend class RectangleBounds;
@@ -183,20 +229,26 @@ inline Acts::ActsSymMatrixD<2> Acts::BoundaryCheck::covariance() const {
 inline Acts::BoundaryCheck::BoundaryCheck(bool check)
     : m_weight(ActsSymMatrixD<2>::Identity()),
       m_tolerance(0, 0),
-      m_type(check ? Type::eAbsolute : Type::eNone) {}
+      m_type(check ? Type::eAbsolute : Type::eNone) {
+  updateMetric();
+}
 
 inline Acts::BoundaryCheck::BoundaryCheck(bool checkLocal0, bool checkLocal1,
                                           double tolerance0, double tolerance1)
     : m_weight(ActsSymMatrixD<2>::Identity()),
       m_tolerance(checkLocal0 ? tolerance0 : DBL_MAX,
                   checkLocal1 ? tolerance1 : DBL_MAX),
-      m_type(Type::eAbsolute) {}
+      m_type(Type::eAbsolute) {
+  updateMetric();
+}
 
 inline Acts::BoundaryCheck::BoundaryCheck(
     const ActsSymMatrixD<2>& localCovariance, double sigmaMax)
     : m_weight(localCovariance.inverse()),
       m_tolerance(sigmaMax, 0),
-      m_type(Type::eChi2) {}
+      m_type(Type::eChi2) {
+  updateMetric();
+}
 
 inline Acts::BoundaryCheck Acts::BoundaryCheck::transformed(
     const ActsMatrixD<2, 2>& jacobian) const {
@@ -209,9 +261,36 @@ inline Acts::BoundaryCheck Acts::BoundaryCheck::transformed(
     bc.m_weight =
         (jacobian * m_weight.inverse() * jacobian.transpose()).inverse();
   }
+  bc.updateMetric();
   return bc;
 }
 
+inline void Acts::BoundaryCheck::updateMetric() {
+  m_reach = std::numeric_limits<double>::infinity();
+  m_choleskyValid = false;
+  if (m_type == Type::eAbsolute) {
+    // the tolerated region is contained in the circle through its corners
+    m_reach = std::hypot(m_tolerance[0], m_tolerance[1]);
+  } else if (m_type == Type::eChi2) {
+    // only the symmetric part of the weight enters the squared norm
+    double a = m_weight(0, 0);
+    double b = 0.5 * (m_weight(0, 1) + m_weight(1, 0));
+    double c = m_weight(1, 1);
+    if (a > 0. and a * c - b * b > 0.) {
+      double u00 = std::sqrt(a);
+      double u01 = b / u00;
+      m_cholesky << u00, u01, 0., std::sqrt(c - u01 * u01);
+      m_choleskyValid = true;
+      // the smallest eigenvalue bounds the squared norm from below
+      double lambdaMin =
+          0.5 * (a + c) - std::sqrt(0.25 * (a - c) * (a - c) + b * b);
+      if (lambdaMin > 0.) {
+        m_reach = std::sqrt(2 * m_tolerance[0] / lambdaMin);
+      }
+    }
+  }
+}
+
 template <typename Vector2DContainer>
 inline bool Acts::BoundaryCheck::isInside(
     const Vector2D& point, const Vector2DContainer& vertices) const {
@@ -241,6 +320,57 @@ inline bool Acts::BoundaryCheck::isInside(
   }
 }
 
+inline bool Acts::BoundaryCheck::isInside(
+    const Vector2D& point, const detail::PolygonEdges& edges) const {
+  if (m_type == Type::eNone) {
+    return true;
+  } else if (edges.isInside(point)) {
+    return true;
+  } else if (m_tolerance == Vector2D(0., 0.)) {
+    return false;
+  } else if (edges.maxLineDistance(point) > m_reach) {
+    // further away from an edge line than any tolerated offset
+    return false;
+  } else {
+    auto closestPoint = computeClosestPointOnPolygon(point, edges);
+    return isTolerated(closestPoint - point);
+  }
+}
+
+inline void Acts::BoundaryCheck::isInside(const std::vector<Vector2D>& points,
+                                          const detail::PolygonEdges& edges,
+                                          std::vector<bool>& inside) const {
+  const size_t nPoints = points.size();
+  inside.assign(nPoints, true);
+  if (m_type == Type::eNone or nPoints == 0) {
+    return;
+  }
+  // edge tests for all points: count the negative sides and keep the
+  // largest distance to the edge lines
+  std::vector<unsigned int> negative(nPoints, 0);
+  std::vector<double> lineDistance(nPoints,
+                                   std::numeric_limits<double>::lowest());
+  const double orientation = edges.orientation();
+  for (const auto& edge : edges.edges()) {
+    const double scale = -orientation * edge.invLength;
+    for (size_t ip = 0; ip < nPoints; ++ip) {
+      double cross =
+          detail::PolygonEdges::cross(edge, points[ip][0], points[ip][1]);
+      negative[ip] += std::signbit(cross) ? 1 : 0;
+      lineDistance[ip] = std::max(lineDistance[ip], scale * cross);
+    }
+  }
+  const bool hasTolerance = (m_tolerance != Vector2D(0., 0.));
+  for (size_t ip = 0; ip < nPoints; ++ip) {
+    if (negative[ip] == 0 or negative[ip] == edges.size()) {
+      continue;
+    }
+    inside[ip] = hasTolerance and lineDistance[ip] <= m_reach and
+                 isTolerated(computeClosestPointOnPolygon(points[ip], edges) -
+                             points[ip]);
+  }
+}
+
 inline bool Acts::BoundaryCheck::isInside(const Vector2D& point,
                                           const Vector2D& lowerLeft,
                                           const Vector2D& upperRight) const {
@@ -276,6 +406,13 @@ inline double Acts::BoundaryCheck::distance(
   return detail::VerticesHelper::isInsidePolygon(point, vertices) ? -d : d;
 }
 
+inline double Acts::BoundaryCheck::distance(
+    const Acts::Vector2D& point, const detail::PolygonEdges& edges) const {
+  double d = std::sqrt(
+      squaredNorm(point - computeClosestPointOnPolygon(point, edges)));
+  return edges.isInside(point) ? -d : d;
+}
+
 inline double Acts::BoundaryCheck::distance(const Acts::Vector2D& point,
                                             const Vector2D& lowerLeft,
                                             const Vector2D& upperRight) const {
@@ -355,6 +492,68 @@ inline Acts::Vector2D Acts::BoundaryCheck::computeClosestPointOnPolygon(
   return closest;
 }
 
+inline Acts::Vector2D Acts::BoundaryCheck::computeClosestPointOnPolygon(
+    const Acts::Vector2D& point, const detail::PolygonEdges& edges) const {
+  Vector2D closest = point;
+  double closestDist = std::numeric_limits<double>::infinity();
+  if (m_type != Type::eChi2) {
+    // Euclidean metric: projection with the precomputed inverse lengths
+    for (const auto& edge : edges.edges()) {
+      double dx = point[0] - edge.x0;
+      double dy = point[1] - edge.y0;
+      double u = std::clamp((dx * edge.ex + dy * edge.ey) * edge.invLength2,
+                            0.0, 1.0);
+      double rx = u * edge.ex - dx;
+      double ry = u * edge.ey - dy;
+      double dist = rx * rx + ry * ry;
+      if (dist < closestDist) {
+        closest = Vector2D(edge.x0 + u * edge.ex, edge.y0 + u * edge.ey);
+        closestDist = dist;
+      }
+    }
+  } else if (m_choleskyValid) {
+    // Mahalanobis metric: Euclidean projection in the whitened frame
+    const double u00 = m_cholesky(0, 0);
+    const double u01 = m_cholesky(0, 1);
+    const double u11 = m_cholesky(1, 1);
+    for (const auto& edge : edges.edges()) {
+      double dx = point[0] - edge.x0;
+      double dy = point[1] - edge.y0;
+      double wdx = u00 * dx + u01 * dy;
+      double wdy = u11 * dy;
+      double wex = u00 * edge.ex + u01 * edge.ey;
+      double wey = u11 * edge.ey;
+      double f = wex * wex + wey * wey;
+      double t = wdx * wex + wdy * wey;
+      // only divide if the projection falls onto the inner part of the edge
+      double u = (t <= 0.) ? 0. : (t >= f) ? 1. : t / f;
+      double rx = u * wex - wdx;
+      double ry = u * wey - wdy;
+      double dist = rx * rx + ry * ry;
+      if (dist < closestDist) {
+        closest = Vector2D(edge.x0 + u * edge.ex, edge.y0 + u * edge.ey);
+        closestDist = dist;
+      }
+    }
+  } else {
+    // weight is not positive definite, use the generic weighted projection
+    for (const auto& edge : edges.edges()) {
+      Vector2D ll0(edge.x0, edge.y0);
+      Vector2D n(edge.ex, edge.ey);
+      Vector2D weighted_n = m_weight * n;
+      double f = n.dot(weighted_n);
+      double u = std::isnormal(f) ? (point - ll0).dot(weighted_n) / f : 0.5;
+      Vector2D current = ll0 + std::clamp(u, 0.0, 1.0) * n;
+      double dist = squaredNorm(current - point);
+      if (dist < closestDist) {
+        closest = current;
+        closestDist = dist;
+      }
+    }
+  }
+  return closest;
+}
+
 inline Acts::Vector2D
 Acts::BoundaryCheck::computeEuclideanClosestPointOnRectangle(
     const Vector2D& point, const Vector2D& lowerLeft,
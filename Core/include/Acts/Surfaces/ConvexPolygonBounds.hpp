@@ -10,6 +10,7 @@
 
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/detail/PolygonEdges.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
 #include <boost/container/small_vector.hpp>
@@ -123,9 +124,13 @@ class ConvexPolygonBounds : public ConvexPolygonBoundsBase {
   /// @return The rectangular bounds
   const RectangleBounds& boundingBox() const final;
 
+  /// Return the precomputed edges, e.g. for batched inside checks
+  const detail::PolygonEdges& edges() const { return m_edges; }
+
  private:
   vertex_array m_vertices;
   RectangleBounds m_boundingBox;
+  detail::PolygonEdges m_edges;
 
   /// Return whether this bounds class is in fact convex
   /// throws a log error if not
@@ -186,9 +191,13 @@ class ConvexPolygonBounds<PolygonDynamic> : public ConvexPolygonBoundsBase {
   ///
   const RectangleBounds& boundingBox() const final;
 
+  /// Return the precomputed edges, e.g. for batched inside checks
+  const detail::PolygonEdges& edges() const { return m_edges; }
+
  private:
   boost::container::small_vector<Vector2D, 10> m_vertices;
   RectangleBounds m_boundingBox;
+  detail::PolygonEdges m_edges;
 
   /// Return whether this bounds class is in fact convex
   /// thorws a logic error if not
@@ -8,7 +8,8 @@
 
 #include "Acts/Utilities/ThrowAssert.hpp"
 
-std::ostream& Acts::ConvexPolygonBoundsBase::toStream(std::ostream& sl) const {
+inline std::ostream& Acts::ConvexPolygonBoundsBase::toStream(
+    std::ostream& sl) const {
   std::vector<Vector2D> vtxs = vertices();
   sl << "Acts::ConvexPolygonBounds<" << vtxs.size() << ">: vertices: [x, y]\n";
   for (size_t i = 0; i < vtxs.size(); i++) {
@@ -37,7 +38,7 @@ Acts::RectangleBounds Acts::ConvexPolygonBoundsBase::makeBoundingBox(
   return {vmin, vmax};
 }
 
-std::vector<double> Acts::ConvexPolygonBoundsBase::values() const {
+inline std::vector<double> Acts::ConvexPolygonBoundsBase::values() const {
   std::vector<double> values;
   for (const auto& vtx : vertices()) {
     values.push_back(vtx.x());
@@ -96,6 +97,7 @@ Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
     m_vertices[i] = vertices[i];
   }
   checkConsistency();
+  m_edges = detail::PolygonEdges(m_vertices);
 }
 
 template <int N>
@@ -103,6 +105,7 @@ Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
     const vertex_array& vertices) noexcept(false)
     : m_vertices(vertices), m_boundingBox(makeBoundingBox(vertices)) {
   checkConsistency();
+  m_edges = detail::PolygonEdges(m_vertices);
 }
 
 template <int N>
@@ -114,6 +117,7 @@ Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
   }
   makeBoundingBox(m_vertices);
   checkConsistency();
+  m_edges = detail::PolygonEdges(m_vertices);
 }
 
 template <int N>
@@ -124,13 +128,13 @@ Acts::SurfaceBounds::BoundsType Acts::ConvexPolygonBounds<N>::type() const {
 template <int N>
 bool Acts::ConvexPolygonBounds<N>::inside(
     const Acts::Vector2D& lposition, const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, m_vertices);
+  return bcheck.isInside(lposition, m_edges);
 }
 
 template <int N>
 double Acts::ConvexPolygonBounds<N>::distanceToBoundary(
     const Acts::Vector2D& lposition) const {
-  return BoundaryCheck(true).distance(lposition, m_vertices);
+  return BoundaryCheck(true).distance(lposition, m_edges);
 }
 
 template <int N>
@@ -149,37 +153,40 @@ void Acts::ConvexPolygonBounds<N>::checkConsistency() const noexcept(false) {
   convex_impl(m_vertices);
 }
 
-Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::ConvexPolygonBounds(
+inline Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::ConvexPolygonBounds(
     const std::vector<Vector2D>& vertices)
     : m_vertices(vertices.begin(), vertices.end()),
-      m_boundingBox(makeBoundingBox(vertices)) {}
+      m_boundingBox(makeBoundingBox(vertices)),
+      m_edges(vertices) {}
 
-Acts::SurfaceBounds::BoundsType
+inline Acts::SurfaceBounds::BoundsType
 Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::type() const {
   return SurfaceBounds::eConvexPolygon;
 }
 
-bool Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::inside(
+inline bool Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::inside(
     const Acts::Vector2D& lposition, const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, m_vertices);
+  return bcheck.isInside(lposition, m_edges);
 }
 
-double Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::distanceToBoundary(
+inline double
+Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::distanceToBoundary(
     const Acts::Vector2D& lposition) const {
-  return BoundaryCheck(true).distance(lposition, m_vertices);
+  return BoundaryCheck(true).distance(lposition, m_edges);
 }
 
-std::vector<Acts::Vector2D> Acts::ConvexPolygonBounds<
+inline std::vector<Acts::Vector2D> Acts::ConvexPolygonBounds<
     Acts::PolygonDynamic>::vertices(unsigned int /*lseg*/) const {
   return {m_vertices.begin(), m_vertices.end()};
 }
 
-const Acts::RectangleBounds&
+inline const Acts::RectangleBounds&
 Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::boundingBox() const {
   return m_boundingBox;
 }
 
-void Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::checkConsistency() const
+inline void
+Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::checkConsistency() const
     noexcept(false) {
   convex_impl(m_vertices);
 }
@@ -10,6 +10,7 @@
 
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/detail/PolygonEdges.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
 
@@ -49,6 +50,7 @@ class DiamondBounds : public PlanarBounds {
         m_boundingBox(*std::max_element(m_values.begin(), m_values.begin() + 2),
                       std::max(halfYneg, halfYpos)) {
     checkConsistency();
+    m_edges = detail::PolygonEdges(vertices());
   }
 
   /// Constructor - from fixed size array
@@ -58,7 +60,9 @@ class DiamondBounds : public PlanarBounds {
       : m_values(values),
         m_boundingBox(
             *std::max_element(values.begin(), values.begin() + 2),
-            std::max(values[eHalfLengthYneg], values[eHalfLengthYpos])) {}
+            std::max(values[eHalfLengthYneg], values[eHalfLengthYpos])) {
+    m_edges = detail::PolygonEdges(vertices());
+  }
 
   ~DiamondBounds() override = default;
 
@@ -98,6 +102,9 @@ class DiamondBounds : public PlanarBounds {
   // Bounding box representation
   const RectangleBounds& boundingBox() const final;
 
+  /// Return the precomputed edges, e.g. for batched inside checks
+  const detail::PolygonEdges& edges() const { return m_edges; }
+
   /// Output Method for std::ostream
   ///
   /// @param sl is the ostream in which it is dumped
@@ -110,6 +117,7 @@ class DiamondBounds : public PlanarBounds {
  private:
   std::array<double, eSize> m_values;
   RectangleBounds m_boundingBox;  ///< internal bounding box cache
+  detail::PolygonEdges m_edges;
 
   /// Check the input values for consistency, will throw a logic_exception
   /// if consistency is not given
@@ -0,0 +1,120 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/detail/TransformColumns.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+namespace Acts {
+
+class GeometryCache;
+class Surface;
+
+/// @class PlaneSurfaceBatch
+///
+/// Structure-of-arrays copy of the placement and bounds of a set of
+/// PlaneSurfaces with RectangleBounds or TrapezoidBounds, used to intersect
+/// a straight line with many candidate surfaces in one pass instead of
+/// calling the virtual Surface::intersect for each of them.
+///
+/// The placement of surfaces without an associated detector element does
+/// not depend on the GeometryContext and is copied into the batch. The
+/// placement of detector element surfaces is read from the columns of a
+/// GeometryCache evaluated for the context, if one is given, and from their
+/// contextual transform otherwise.
+///
+/// Both bounds types are stored as a trapezoid symmetric around a local
+/// x centre, with the half length in x varying linearly in y; a rectangle
+/// is a trapezoid with vanishing slope.
+class PlaneSurfaceBatch {
+ public:
+  /// Slot index returned for surfaces that are not in the batch
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  /// Default constructor, creates an empty batch
+  PlaneSurfaceBatch() = default;
+
+  /// Constructor from a list of surfaces, unsupported ones are skipped
+  ///
+  /// @param surfaces The candidate surfaces to be batched
+  PlaneSurfaceBatch(const std::vector<const Surface*>& surfaces);
+
+  /// Check whether a surface can be batched
+  ///
+  /// @param surface The surface to be checked
+  static bool canBatch(const Surface& surface);
+
+  /// Number of batched surfaces
+  size_t size() const { return m_surfaces.size(); }
+
+  /// Check whether the batch is empty
+  bool empty() const { return m_surfaces.empty(); }
+
+  /// Check whether a boundary check can be evaluated by the batch, this is
+  /// the case for no check and for absolute checks, the latter only with
+  /// vanishing tolerance if trapezoids are present.
+  ///
+  /// @param bcheck The boundary check directive
+  bool supports(const BoundaryCheck& bcheck) const;
+
+  /// Slot of a surface within the batch
+  ///
+  /// @param surface The surface to be looked up
+  ///
+  /// @return the slot index or npos if the surface is not batched
+  size_t slot(const Surface* surface) const;
+
+  /// Surface for a given slot
+  ///
+  /// @param islot The slot index
+  const Surface& surface(size_t islot) const { return *m_surfaces[islot]; }
+
+  /// Straight line intersection with a list of batched surfaces
+  ///
+  /// The status, path length and position of valid intersections agree with
+  /// PlaneSurface::intersectionEstimate for each of the surfaces, invalid
+  /// ones are returned as default Intersection.
+  ///
+  /// @param gctx The geometry context for the detector element placements
+  /// @param position The start position of the straight line
+  /// @param direction The (normalized) direction of the straight line
+  /// @param bcheck The boundary check directive, must be supported
+  /// @param slots The slot indices to be intersected
+  /// @param [out] intersections The intersections, one per slot
+  /// @param cache The optional geometry cache, must be evaluated for gctx
+  void intersect(const GeometryContext& gctx, const Vector3D& position,
+                 const Vector3D& direction, const BoundaryCheck& bcheck,
+                 const std::vector<size_t>& slots,
+                 std::vector<Intersection>& intersections,
+                 const GeometryCache* cache = nullptr) const;
+
+ private:
+  /// The batched surfaces, sorted by address for the slot lookup
+  std::vector<const Surface*> m_surfaces;
+
+  /// Indicates whether the placement of a surface depends on the context
+  std::vector<char> m_contextual;
+
+  /// The placements, these are left at zero for contextual surfaces
+  detail::TransformColumns m_placements;
+
+  /// Bounds: local centre, half lengths at the y centre, slope of the
+  /// half length in x along y
+  std::vector<double> m_x0, m_y0, m_hx, m_hy, m_slope;
+
+  /// Indicates whether any of the bounds is a trapezoid
+  bool m_hasTrapezoids = false;
+};
+
+}  // namespace Acts
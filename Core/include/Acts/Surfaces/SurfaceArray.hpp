@@ -22,6 +22,48 @@ namespace Acts {
 
 using SurfaceVector = std::vector<const Surface*>;
 
+/// @brief Non-owning view of a contiguous sequence of surface pointers
+///
+/// Returned by the neighbor lookups of the @c SurfaceArray, the view points
+/// into the storage of the lookup and is valid as long as the lookup is.
+class SurfaceRange {
+ public:
+  using value_type = const Surface*;
+  using const_iterator = const Surface* const*;
+  using iterator = const_iterator;
+
+  /// @brief Default constructor, creates an empty range
+  SurfaceRange() = default;
+
+  /// @brief Constructor from a pointer range
+  /// @param first The first element
+  /// @param last One past the last element
+  SurfaceRange(const_iterator first, const_iterator last)
+      : m_begin(first), m_end(last) {}
+
+  /// @brief Constructor from a vector, the vector must outlive the range
+  /// @param surfaces The vector to view
+  /// @note Explicit, such that a range is never bound to a temporary
+  explicit SurfaceRange(const SurfaceVector& surfaces)
+      : m_begin(surfaces.data()), m_end(surfaces.data() + surfaces.size()) {}
+
+  const_iterator begin() const { return m_begin; }
+  const_iterator end() const { return m_end; }
+  size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+  bool empty() const { return m_begin == m_end; }
+  const Surface* operator[](size_t i) const { return m_begin[i]; }
+
+  /// @brief Copy the viewed surface pointers into a vector
+  /// @note Explicit, such that copies are never made silently
+  explicit operator SurfaceVector() const {
+    return SurfaceVector(m_begin, m_end);
+  }
+
+ private:
+  const_iterator m_begin = nullptr;
+  const_iterator m_end = nullptr;
+};
+
 /// @brief Provides Surface binning in N dimensions
 ///
 /// Uses @c Grid under the hood to implement the storage and lookup
@@ -75,8 +117,8 @@ class SurfaceArray {
     /// @brief Performs a lookup at @c pos, but returns neighbors as well
     ///
     /// @param position Lookup position
-    /// @return @c SurfaceVector at given bin. Copy of all bins selected
-    virtual const SurfaceVector& neighbors(const Vector3D& position) const = 0;
+    /// @return @c SurfaceRange of the combined content of all bins selected
+    virtual SurfaceRange neighbors(const Vector3D& position) const = 0;
 
     /// @brief Returns the total size of the grid (including under/overflow
     /// bins)
@@ -136,7 +178,7 @@ class SurfaceArray {
         : m_globalToLocal(std::move(globalToLocal)),
           m_localToGlobal(std::move(localToGlobal)),
           m_grid(std::move(axes)) {
-      m_neighborMap.resize(m_grid.size());
+      m_neighborOffsets.assign(m_grid.size() + 1, 0);
     }
 
     /// @brief Fill provided surfaces into the contained @c Grid.
@@ -235,10 +277,13 @@ class SurfaceArray {
     /// @brief Performs a lookup at @c pos, but returns neighbors as well
     ///
     /// @param position Lookup position
-    /// @return @c SurfaceVector at given bin. Copy of all bins selected
-    const SurfaceVector& neighbors(const Vector3D& position) const override {
+    /// @return @c SurfaceRange of the combined content of all bins selected
+    SurfaceRange neighbors(const Vector3D& position) const override {
       auto lposition = m_globalToLocal(position);
-      return m_neighborMap.at(m_grid.globalBinFromPosition(lposition));
+      size_t bin = m_grid.globalBinFromPosition(lposition);
+      const Surface* const* first = m_neighborSurfaces.data();
+      return SurfaceRange(first + m_neighborOffsets.at(bin),
+                          first + m_neighborOffsets.at(bin + 1));
     }
 
     /// @brief Returns the total size of the grid (including under/overflow
@@ -285,22 +330,23 @@ class SurfaceArray {
 
    private:
     void populateNeighborCache() {
-      // calculate neighbors for every bin and store in map
+      // calculate neighbors for every bin and store them contiguously, the
+      // neighbors of bin i are in [offsets[i], offsets[i+1])
+      m_neighborSurfaces.clear();
+      m_neighborOffsets.assign(m_grid.size() + 1, 0);
       for (size_t i = 0; i < m_grid.size(); i++) {
-        if (!isValidBin(i)) {
-          continue;
-        }
-        typename Grid_t::index_t loc = m_grid.localBinsFromGlobalBin(i);
-        auto neighborIdxs = m_grid.neighborHoodIndices(loc, 1u);
-        std::vector<const Surface*>& neighbors = m_neighborMap.at(i);
-        neighbors.clear();
-
-        for (const auto& idx : neighborIdxs) {
-          const std::vector<const Surface*>& binContent = m_grid.at(idx);
-          std::copy(binContent.begin(), binContent.end(),
-                    std::back_inserter(neighbors));
+        if (isValidBin(i)) {
+          typename Grid_t::index_t loc = m_grid.localBinsFromGlobalBin(i);
+          auto neighborIdxs = m_grid.neighborHoodIndices(loc, 1u);
+          for (const auto& idx : neighborIdxs) {
+            const std::vector<const Surface*>& binContent = m_grid.at(idx);
+            std::copy(binContent.begin(), binContent.end(),
+                      std::back_inserter(m_neighborSurfaces));
+          }
         }
+        m_neighborOffsets[i + 1] = m_neighborSurfaces.size();
       }
+      m_neighborSurfaces.shrink_to_fit();
     }
 
     /// Internal method.
@@ -330,7 +376,10 @@ class SurfaceArray {
     std::function<point_t(const Vector3D&)> m_globalToLocal;
     std::function<Vector3D(const point_t&)> m_localToGlobal;
     Grid_t m_grid;
-    std::vector<SurfaceVector> m_neighborMap;
+    /// offsets of the neighbors of every bin in m_neighborSurfaces
+    std::vector<size_t> m_neighborOffsets;
+    /// neighbors of all bins in one contiguous block
+    SurfaceVector m_neighborSurfaces;
   };
 
   /// @brief Lookup implementation which wraps one element and always returns
@@ -369,10 +418,9 @@ class SurfaceArray {
 
     /// @brief Lookup, always returns @c element
     /// @param position is ignored
-    /// @return reference to vector containing only @c element
-    const SurfaceVector& neighbors(
-        const Vector3D& /*position*/) const override {
-      return m_element;
+    /// @return range containing only @c element
+    SurfaceRange neighbors(const Vector3D& /*position*/) const override {
+      return SurfaceRange(m_element);
     }
 
     /// @brief returns 1
@@ -467,12 +515,10 @@ class SurfaceArray {
 
   /// @brief Get all surfaces in bin at @p pos and its neighbors
   /// @param position The position to lookup as nominal
-  /// @param size How many neighbors we want in each direction. (default: 1)
-  /// @return Merged @c SurfaceVector of neighbors and nominal
-  /// @note The @c SurfaceVector will be combined. For technical reasons, the
-  ///       different bin content vectors have to be copied, so the resulting
-  ///       vector contains copies.
-  SurfaceVector neighbors(const Vector3D& position) const {
+  /// @return Merged @c SurfaceRange of neighbors and nominal
+  /// @note The range points into the contiguous neighbor storage of the
+  ///       lookup, no surface pointers are copied.
+  SurfaceRange neighbors(const Vector3D& position) const {
     return p_gridLookup->neighbors(position);
   }
 
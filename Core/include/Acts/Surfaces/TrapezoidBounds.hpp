@@ -11,6 +11,7 @@
 
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/detail/PolygonEdges.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
 
@@ -21,8 +22,6 @@ namespace Acts {
 /// Bounds for a trapezoidal, planar Surface.
 ///
 /// @image html TrapezoidBounds.gif
-///
-/// @todo can be speed optimized by calculating kappa/delta and caching it
 
 class TrapezoidBounds : public PlanarBounds {
  public:
@@ -45,6 +44,7 @@ class TrapezoidBounds : public PlanarBounds {
       : m_values({halfXnegY, halfXposY, halfY}),
         m_boundingBox(std::max(halfXnegY, halfXposY), halfY) {
     checkConsistency();
+    m_edges = detail::PolygonEdges(vertices());
   }
 
   /// Constructor for symmetric Trapezoid - from fixed size array
@@ -56,6 +56,7 @@ class TrapezoidBounds : public PlanarBounds {
             std::max(values[eHalfLengthXnegY], values[eHalfLengthXposY]),
             values[eHalfLengthY]) {
     checkConsistency();
+    m_edges = detail::PolygonEdges(vertices());
   }
 
   ~TrapezoidBounds() override;
@@ -130,6 +131,9 @@ class TrapezoidBounds : public PlanarBounds {
   // Bounding box representation
   const RectangleBounds& boundingBox() const final;
 
+  /// Return the precomputed edges, e.g. for batched inside checks
+  const detail::PolygonEdges& edges() const { return m_edges; }
+
   /// Output Method for std::ostream
   ///
   /// @param sl is the ostream to be dumped into
@@ -142,6 +146,7 @@ class TrapezoidBounds : public PlanarBounds {
  private:
   std::array<double, eSize> m_values;
   RectangleBounds m_boundingBox;
+  detail::PolygonEdges m_edges;
 
   /// Check the input values for consistency, will throw a logic_exception
   /// if consistency is not given
@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "Acts/Utilities/Definitions.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @class PolygonEdges
+///
+/// Precomputed edge description of a convex polygon, i.e. start point,
+/// edge vector and inverse edge lengths, for repeated inside and distance
+/// checks without recomputing them from the vertices for every query.
+class PolygonEdges {
+ public:
+  /// Single edge from `(x0, y0)` to `(x0 + ex, y0 + ey)`
+  struct Edge {
+    double x0 = 0.;
+    double y0 = 0.;
+    double ex = 0.;
+    double ey = 0.;
+    /// inverse length of the edge
+    double invLength = 0.;
+    /// inverse squared length of the edge
+    double invLength2 = 0.;
+  };
+
+  PolygonEdges() = default;
+
+  /// Constructor from the vertices
+  ///
+  /// @param vertices Forward iterable container of convex polygon vertices,
+  ///                 in either orientation
+  template <typename vertex_container_t>
+  explicit PolygonEdges(const vertex_container_t& vertices) {
+    std::vector<Vector2D> points(std::begin(vertices), std::end(vertices));
+    m_edges.reserve(points.size());
+    double area = 0.;
+    for (size_t iv = 0; iv < points.size(); ++iv) {
+      const Vector2D& start = points[iv];
+      const Vector2D& end = points[(iv + 1) % points.size()];
+      Edge edge;
+      edge.x0 = start.x();
+      edge.y0 = start.y();
+      edge.ex = end.x() - start.x();
+      edge.ey = end.y() - start.y();
+      double length2 = edge.ex * edge.ex + edge.ey * edge.ey;
+      edge.invLength = 1. / std::sqrt(length2);
+      edge.invLength2 = 1. / length2;
+      m_edges.push_back(edge);
+      area += start.x() * end.y() - end.x() * start.y();
+    }
+    m_orientation = (area < 0.) ? -1. : 1.;
+  }
+
+  /// Number of edges
+  size_t size() const { return m_edges.size(); }
+
+  /// The edges, in the order of the vertices
+  const std::vector<Edge>& edges() const { return m_edges; }
+
+  /// +1 for counter-clockwise, -1 for clockwise vertex order
+  double orientation() const { return m_orientation; }
+
+  /// Cross product of an edge with the vector from its start to a point,
+  /// positive on the inside of a counter-clockwise polygon
+  ///
+  /// @param edge The edge
+  /// @param x The first point coordinate
+  /// @param y The second point coordinate
+  static double cross(const Edge& edge, double x, double y) {
+    return (edge.ex * (y - edge.y0)) - (edge.ey * (x - edge.x0));
+  }
+
+  /// Check if the point is inside the polygon w/o any tolerances, with the
+  /// same convention as VerticesHelper::isInsidePolygon
+  ///
+  /// @param point The point to check
+  bool isInside(const Vector2D& point) const {
+    bool reference = std::signbit(cross(m_edges.front(), point.x(), point.y()));
+    for (size_t ie = 1; ie < m_edges.size(); ++ie) {
+      if (std::signbit(cross(m_edges[ie], point.x(), point.y())) !=
+          reference) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// The largest signed distance of the point to the lines through the
+  /// edges, positive on the outside
+  ///
+  /// For a convex polygon this is the exact (negative) distance to the
+  /// boundary for points inside, and a lower bound of the distance to the
+  /// polygon for points outside.
+  ///
+  /// @param point The point to check
+  double maxLineDistance(const Vector2D& point) const {
+    double distance = std::numeric_limits<double>::lowest();
+    for (const auto& edge : m_edges) {
+      distance = std::max(distance, -m_orientation * edge.invLength *
+                                        cross(edge, point.x(), point.y()));
+    }
+    return distance;
+  }
+
+ private:
+  std::vector<Edge> m_edges;
+  double m_orientation = 1.;
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -112,6 +112,19 @@ class BinnedArrayXD : public BinnedArray<T> {
     }
   }
 
+  /// Constructor with a grid, the ordered objects and a BinUtility
+  /// - e.g. to restore an array with its original object order
+  ///
+  /// @param grid is the prepared object grid
+  /// @param objects are the unique objects of the grid in their order
+  /// @param bu is the unique bin utility for this binned array
+  BinnedArrayXD(const std::vector<std::vector<std::vector<T>>>& grid,
+                std::vector<T> objects, std::unique_ptr<const BinUtility> bu)
+      : BinnedArray<T>(),
+        m_objectGrid(grid),
+        m_arrayObjects(std::move(objects)),
+        m_binUtility(std::move(bu)) {}
+
   /// Copy constructor
   /// - not allowed, use the same array
   BinnedArrayXD(const BinnedArrayXD<T>& barr) = delete;
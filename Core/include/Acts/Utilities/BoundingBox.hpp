@@ -10,8 +10,10 @@
 
 #include <algorithm>
 #include <array>
+#include <future>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <ostream>
 #include <tuple>
 #include <vector>
@@ -199,6 +201,30 @@ class AxisAlignedBoundingBox {
   template <size_t sides>
   bool intersect(const Frustum<value_type, DIM, sides>& fr) const;
 
+  /**
+   * Ray intersection of a box given by its corners, see the member
+   * function. This allows compact copies of the box, e.g. in a flattened
+   * hierarchy, to share the same intersection code.
+   * @param vmin The minimum vertex of the box
+   * @param vmax The maximum vertex of the box
+   * @param ray The ray to intersect with
+   * @return Whether the ray intersects the box
+   */
+  static bool intersect(const VertexType& vmin, const VertexType& vmax,
+                        const Ray<value_type, DIM>& ray);
+
+  /**
+   * Frustum intersection of a box given by its corners, see the member
+   * function.
+   * @param vmin The minimum vertex of the box
+   * @param vmax The maximum vertex of the box
+   * @param fr The frustum
+   * @return Whether the frustum intersects the box
+   */
+  template <size_t sides>
+  static bool intersect(const VertexType& vmin, const VertexType& vmax,
+                        const Frustum<value_type, DIM, sides>& fr);
+
   /**
    * Set the skip node (bounding box)
    * @param skip The target skip node pointer
@@ -346,6 +372,59 @@ box_t* make_octree(std::vector<std::unique_ptr<box_t>>& store,
                    const std::vector<box_t*>& prims, size_t max_depth = 1,
                    typename box_t::value_type envelope1 = 0);
 
+/**
+ * Build a binary hierarchy from a list of bounding boxes using the binned
+ * surface area heuristic (SAH). At every node the boxes are split along the
+ * axis and bin boundary of their centers which minimizes the expected number
+ * of box tests, which gives well balanced trees also for elongated
+ * arrangements (e.g. barrels). Independent subtrees can be built concurrently.
+ * This is a drop-in replacement for @c make_octree.
+ * @note The result does not depend on @p n_threads.
+ * @tparam box_t Works will all 3D box types.
+ * @param store Owns the created boxes by means of `std::unique_ptr`.
+ * @param prims Boxes to store. This is a read only vector.
+ * @param max_leaf_size Nodes with at most this many boxes are not split.
+ * @param envelope1 Envelope to add/subtract to dimensions in all directions.
+ * @param n_threads Maximum number of threads used to build subtrees.
+ * @return Pointer to the top most bounding box, containing the entire tree
+ */
+template <typename box_t>
+box_t* make_sah_tree(std::vector<std::unique_ptr<box_t>>& store,
+                     const std::vector<box_t*>& prims, size_t max_leaf_size = 4,
+                     typename box_t::value_type envelope1 = 0,
+                     size_t n_threads = 1);
+
+/**
+ * Quality metrics of a bounding box hierarchy.
+ */
+struct BoundingBoxHierarchyStats {
+  /// Total number of boxes in the hierarchy
+  size_t nodes = 0;
+  /// Number of boxes with an associated entity
+  size_t leaves = 0;
+  /// Number of levels of the hierarchy, 1 for a single box
+  size_t depth = 0;
+  /// Expected cost of a traversal which hits the top box: every box is tested
+  /// with the probability that its parent is hit, every entity with the
+  /// probability that its own box is hit, the probabilities being estimated
+  /// by the surface area ratios w.r.t. the top box.
+  double expectedCost = 0;
+};
+
+/**
+ * Calculate quality metrics for a bounding box hierarchy, e.g. to compare
+ * hierarchies created by @c make_octree and @c make_sah_tree.
+ * @tparam box_t Works will all 3D box types.
+ * @param top The top most box of the hierarchy
+ * @param box_cost Cost of testing one box
+ * @param entity_cost Cost of testing the entity of a leaf box
+ * @return The quality metrics
+ */
+template <typename box_t>
+BoundingBoxHierarchyStats hierarchy_stats(const box_t* top,
+                                          double box_cost = 1.,
+                                          double entity_cost = 1.);
+
 /**
  * Overload of the << operator for bounding boxes.
  * @tparam T entity type
@@ -117,14 +117,21 @@ bool Acts::AxisAlignedBoundingBox<entity_t, value_t, DIM>::intersect(
 template <typename entity_t, typename value_t, size_t DIM>
 bool Acts::AxisAlignedBoundingBox<entity_t, value_t, DIM>::intersect(
     const Ray<value_type, DIM>& ray) const {
+  return intersect(m_vmin, m_vmax, ray);
+}
+
+template <typename entity_t, typename value_t, size_t DIM>
+bool Acts::AxisAlignedBoundingBox<entity_t, value_t, DIM>::intersect(
+    const VertexType& vmin, const VertexType& vmax,
+    const Ray<value_type, DIM>& ray) {
   const VertexType& origin = ray.origin();
   const vertex_array_type& idir = ray.idir();
 
   // Calculate the intersect distances with the min and max planes along the ray
   // direction, from the ray origin. See Ch VII.5 Fig.1 in [1].
   // This is done in all dimensions at the same time:
-  vertex_array_type t0s = (m_vmin - origin).array() * idir;
-  vertex_array_type t1s = (m_vmax - origin).array() * idir;
+  vertex_array_type t0s = (vmin - origin).array() * idir;
+  vertex_array_type t1s = (vmax - origin).array() * idir;
 
   // Calculate the component wise min/max between the t0s and t1s
   // this is non-compliant with IEEE-754-2008, NaN gets propagated through
@@ -147,11 +154,19 @@ template <typename entity_t, typename value_t, size_t DIM>
 template <size_t sides>
 bool Acts::AxisAlignedBoundingBox<entity_t, value_t, DIM>::intersect(
     const Frustum<value_type, DIM, sides>& fr) const {
+  return intersect(m_vmin, m_vmax, fr);
+}
+
+template <typename entity_t, typename value_t, size_t DIM>
+template <size_t sides>
+bool Acts::AxisAlignedBoundingBox<entity_t, value_t, DIM>::intersect(
+    const VertexType& vmin, const VertexType& vmax,
+    const Frustum<value_type, DIM, sides>& fr) {
   const auto& normals = fr.normals();
   // Transform vmin and vmax into the coordinate system, at which the frustum is
   // located at the coordinate origin.
-  const vertex_array_type fr_vmin = m_vmin - fr.origin();
-  const vertex_array_type fr_vmax = m_vmax - fr.origin();
+  const vertex_array_type fr_vmin = vmin - fr.origin();
+  const vertex_array_type fr_vmax = vmax - fr.origin();
 
   // For each plane, find the p-vertex, which is the vertex that is at the
   // furthest distance from the plane *along* it's normal direction.
@@ -544,6 +559,217 @@ box_t* Acts::make_octree(std::vector<std::unique_ptr<box_t>>& store,
   return top;
 }
 
+namespace Acts {
+namespace detail {
+
+template <typename vertex_t>
+double box_surface_area(const vertex_t& vmin, const vertex_t& vmax) {
+  double wx = vmax[0] - vmin[0];
+  double wy = vmax[1] - vmin[1];
+  double wz = vmax[2] - vmin[2];
+  return 2. * (wx * wy + wy * wz + wz * wx);
+}
+
+template <typename box_t>
+box_t* sah_inner(std::vector<std::unique_ptr<box_t>>& store,
+                 size_t max_leaf_size,
+                 typename box_t::vertex_array_type envelope,
+                 std::vector<box_t*> lprims, size_t n_threads) {
+  using vertex_array_type = typename box_t::vertex_array_type;
+  using value_type = typename box_t::value_type;
+  constexpr size_t n_bins = 16;
+
+  assert(lprims.size() > 0);
+  if (lprims.size() == 1) {
+    // just return
+    return lprims.front();
+  }
+
+  if (lprims.size() <= max_leaf_size) {
+    // just wrap them all up
+    store.push_back(std::make_unique<box_t>(lprims, envelope));
+    return store.back().get();
+  }
+
+  // extent of the box centers
+  vertex_array_type cmin(
+      vertex_array_type::Constant(std::numeric_limits<value_type>::max()));
+  vertex_array_type cmax(
+      vertex_array_type::Constant(std::numeric_limits<value_type>::lowest()));
+  for (const auto* box : lprims) {
+    cmin = cmin.min(box->center().array());
+    cmax = cmax.max(box->center().array());
+  }
+
+  // find the cheapest split over all axes and bin boundaries
+  double best_cost = std::numeric_limits<double>::infinity();
+  size_t best_axis = box_t::dim;
+  size_t best_split = 0;
+  auto bin_of = [&](const box_t* box, size_t axis) {
+    value_type scale = n_bins / (cmax[axis] - cmin[axis]);
+    auto bin = static_cast<size_t>((box->center()[axis] - cmin[axis]) * scale);
+    return std::min(bin, n_bins - 1);
+  };
+  for (size_t axis = 0; axis < box_t::dim; ++axis) {
+    if (not(cmax[axis] > cmin[axis])) {
+      continue;
+    }
+    std::array<size_t, n_bins> counts{};
+    std::array<vertex_array_type, n_bins> bmin, bmax;
+    bmin.fill(
+        vertex_array_type::Constant(std::numeric_limits<value_type>::max()));
+    bmax.fill(
+        vertex_array_type::Constant(std::numeric_limits<value_type>::lowest()));
+    for (const auto* box : lprims) {
+      size_t bin = bin_of(box, axis);
+      counts[bin]++;
+      bmin[bin] = bmin[bin].min(box->min().array());
+      bmax[bin] = bmax[bin].max(box->max().array());
+    }
+
+    // sweep from the right, cost of everything above a bin boundary
+    std::array<double, n_bins> right_cost{};
+    vertex_array_type rmin = bmin.back();
+    vertex_array_type rmax = bmax.back();
+    size_t rcount = counts.back();
+    for (size_t bin = n_bins - 1; bin > 0; --bin) {
+      rmin = rmin.min(bmin[bin]);
+      rmax = rmax.max(bmax[bin]);
+      rcount += (bin < n_bins - 1) ? counts[bin] : 0;
+      right_cost[bin] =
+          rcount > 0 ? rcount * box_surface_area(rmin, rmax) : 0.;
+    }
+
+    // sweep from the left, combine with the right side
+    vertex_array_type lmin = bmin.front();
+    vertex_array_type lmax = bmax.front();
+    size_t lcount = 0;
+    for (size_t bin = 0; bin < n_bins - 1; ++bin) {
+      lmin = lmin.min(bmin[bin]);
+      lmax = lmax.max(bmax[bin]);
+      lcount += counts[bin];
+      if (lcount == 0 or lcount == lprims.size()) {
+        continue;
+      }
+      double cost = lcount * box_surface_area(lmin, lmax) + right_cost[bin + 1];
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_axis = axis;
+        best_split = bin;
+      }
+    }
+  }
+
+  std::vector<box_t*> left_prims, right_prims;
+  if (best_axis == box_t::dim) {
+    // all centers coincide, split in two halves
+    size_t half = lprims.size() / 2;
+    left_prims.assign(lprims.begin(), lprims.begin() + half);
+    right_prims.assign(lprims.begin() + half, lprims.end());
+  } else {
+    for (auto* box : lprims) {
+      if (bin_of(box, best_axis) <= best_split) {
+        left_prims.push_back(box);
+      } else {
+        right_prims.push_back(box);
+      }
+    }
+  }
+  lprims.clear();
+
+  box_t* left = nullptr;
+  box_t* right = nullptr;
+  // only worth to spawn a thread for sizeable subtrees
+  if (n_threads > 1 and left_prims.size() > 256) {
+    std::vector<std::unique_ptr<box_t>> left_store;
+    std::vector<std::unique_ptr<box_t>> right_store;
+    size_t left_threads = n_threads / 2;
+    auto left_future = std::async(std::launch::async, [&]() {
+      return sah_inner(left_store, max_leaf_size, envelope,
+                       std::move(left_prims), left_threads);
+    });
+    right = sah_inner(right_store, max_leaf_size, envelope,
+                      std::move(right_prims), n_threads - left_threads);
+    left = left_future.get();
+    // same order of the store as in the sequential build
+    for (auto& box : left_store) {
+      store.push_back(std::move(box));
+    }
+    for (auto& box : right_store) {
+      store.push_back(std::move(box));
+    }
+  } else {
+    left = sah_inner(store, max_leaf_size, envelope, std::move(left_prims),
+                     n_threads);
+    right = sah_inner(store, max_leaf_size, envelope, std::move(right_prims),
+                      n_threads);
+  }
+
+  store.push_back(
+      std::make_unique<box_t>(std::vector<box_t*>{left, right}, envelope));
+  return store.back().get();
+}
+
+template <typename box_t>
+void hierarchy_stats_inner(const box_t* node, double parent_area,
+                           size_t depth, double box_cost, double entity_cost,
+                           BoundingBoxHierarchyStats& stats) {
+  double area = box_surface_area(node->min(), node->max());
+  stats.nodes++;
+  stats.depth = std::max(stats.depth, depth);
+  stats.expectedCost += box_cost * parent_area;
+  if (node->hasEntity()) {
+    stats.leaves++;
+    stats.expectedCost += entity_cost * area;
+    return;
+  }
+  // the last child continues with the same node as its parent
+  const box_t* child = node->getLeftChild();
+  while (child != nullptr and child != node->getSkip()) {
+    hierarchy_stats_inner(child, area, depth + 1, box_cost, entity_cost,
+                          stats);
+    child = child->getSkip();
+  }
+}
+
+}  // namespace detail
+}  // namespace Acts
+
+template <typename box_t>
+box_t* Acts::make_sah_tree(std::vector<std::unique_ptr<box_t>>& store,
+                           const std::vector<box_t*>& prims,
+                           size_t max_leaf_size,
+                           typename box_t::value_type envelope1,
+                           size_t n_threads) {
+  static_assert(box_t::dim == 3, "SAH tree can only be created in 3D");
+
+  using vertex_array_type = typename box_t::vertex_array_type;
+
+  vertex_array_type envelope(vertex_array_type::Constant(envelope1));
+
+  return detail::sah_inner(store, std::max<size_t>(max_leaf_size, 1),
+                           envelope, prims, std::max<size_t>(n_threads, 1));
+}
+
+template <typename box_t>
+Acts::BoundingBoxHierarchyStats Acts::hierarchy_stats(const box_t* top,
+                                                      double box_cost,
+                                                      double entity_cost) {
+  static_assert(box_t::dim == 3, "Hierarchy stats only defined in 3D");
+
+  BoundingBoxHierarchyStats stats;
+  if (top == nullptr) {
+    return stats;
+  }
+  double top_area = detail::box_surface_area(top->min(), top->max());
+  detail::hierarchy_stats_inner(top, top_area, 1, box_cost, entity_cost,
+                                stats);
+  if (top_area > 0) {
+    stats.expectedCost /= top_area;
+  }
+  return stats;
+}
+
 template <typename T, typename U, size_t V>
 std::ostream& operator<<(std::ostream& os,
                          const Acts::AxisAlignedBoundingBox<T, U, V>& box) {
@@ -0,0 +1,86 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Acts/Utilities/BoundingBox.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Frustum.hpp"
+#include "Acts/Utilities/Ray.hpp"
+
+namespace Acts {
+
+/// Linearised, read-only copy of a bounding box hierarchy.
+///
+/// The linked hierarchy (e.g. created by @c make_octree) is flattened in
+/// depth-first order into one contiguous node array. The first child of an
+/// inner node is always the next node in the array, and every node stores the
+/// index of the node to continue with when it is not entered (the skip
+/// index). Traversal is therefore a single forward loop over the array
+/// without pointer chasing or a stack.
+///
+/// @tparam box_t The bounding box type of the source hierarchy
+template <typename box_t>
+class FlatBoundingBoxHierarchy {
+ public:
+  /// Re-export the value type of the box
+  using value_type = typename box_t::value_type;
+  /// Re-export the entity type of the box
+  using entity_type = typename box_t::entity_type;
+  /// Vertex type of the box
+  using VertexType = typename box_t::VertexType;
+  /// Re-export the dimension of the box
+  static constexpr size_t dim = box_t::dim;
+
+  /// Compact node: bounds and skip index share a cache line
+  struct Node {
+    VertexType vmin;
+    VertexType vmax;
+    /// index of the node to continue with if this node is not entered
+    uint32_t skip;
+  };
+
+  /// Default constructor, creates an empty hierarchy
+  FlatBoundingBoxHierarchy() = default;
+
+  /// Constructor from the top node of a linked hierarchy
+  /// @param top The top node, can be nullptr
+  explicit FlatBoundingBoxHierarchy(const box_t* top);
+
+  /// Number of nodes in the hierarchy
+  /// @return The number of nodes
+  size_t size() const { return m_nodes.size(); }
+
+  /// Check whether the hierarchy contains any nodes
+  /// @return Whether the hierarchy is empty
+  bool empty() const { return m_nodes.empty(); }
+
+  /// Access to the flattened nodes
+  /// @return The nodes in depth-first order
+  const std::vector<Node>& nodes() const { return m_nodes; }
+
+  /// Collect the entities of all leaf boxes intersected by a ray or frustum
+  /// @tparam object_t Either a @c Ray or a @c Frustum
+  /// @param obj The object to intersect with
+  /// @return The entities of the intersected leaf boxes, in the same order
+  ///         as the traversal of the linked hierarchy
+  template <typename object_t>
+  std::vector<const entity_type*> intersect(const object_t& obj) const;
+
+ private:
+  /// The nodes in depth-first order
+  std::vector<Node> m_nodes;
+  /// The entities per node, nullptr for inner nodes
+  std::vector<const entity_type*> m_entities;
+};
+
+}  // namespace Acts
+
+#include "Acts/Utilities/FlatBoundingBoxHierarchy.ipp"
@@ -0,0 +1,79 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+template <typename box_t>
+Acts::FlatBoundingBoxHierarchy<box_t>::FlatBoundingBoxHierarchy(
+    const box_t* top) {
+  if (top == nullptr) {
+    return;
+  }
+
+  // Visit all nodes in the order of the linked traversal, i.e. as if every
+  // node was intersected, which is the depth-first order.
+  std::vector<const box_t*> order;
+  std::unordered_map<const box_t*, uint32_t> index;
+  const box_t* lnode = top;
+  do {
+    index.emplace(lnode, static_cast<uint32_t>(order.size()));
+    order.push_back(lnode);
+    if (not lnode->hasEntity() and lnode->getLeftChild() != nullptr) {
+      lnode = lnode->getLeftChild();
+    } else {
+      lnode = lnode->getSkip();
+    }
+  } while (lnode != nullptr);
+
+  if (order.size() >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Bounding box hierarchy is too large");
+  }
+
+  const uint32_t end = static_cast<uint32_t>(order.size());
+  m_nodes.reserve(order.size());
+  m_entities.reserve(order.size());
+  for (const box_t* box : order) {
+    Node node;
+    node.vmin = box->min();
+    node.vmax = box->max();
+    // the skip of the top node might point outside of the hierarchy
+    auto skip = index.find(box->getSkip());
+    node.skip = (skip == index.end()) ? end : skip->second;
+    m_nodes.push_back(node);
+    m_entities.push_back(box->entity());
+  }
+}
+
+template <typename box_t>
+template <typename object_t>
+std::vector<const typename Acts::FlatBoundingBoxHierarchy<box_t>::entity_type*>
+Acts::FlatBoundingBoxHierarchy<box_t>::intersect(const object_t& obj) const {
+  std::vector<const entity_type*> hits;
+  hits.reserve(20);  // arbitrary
+  const size_t nNodes = m_nodes.size();
+  size_t inode = 0;
+  while (inode < nNodes) {
+    const Node& node = m_nodes[inode];
+    if (box_t::intersect(node.vmin, node.vmax, obj)) {
+      const entity_type* entity = m_entities[inode];
+      if (entity != nullptr) {
+        // found primitive
+        hits.push_back(entity);
+        inode = node.skip;
+      } else {
+        // the first child is the next node
+        ++inode;
+      }
+    } else {
+      inode = node.skip;
+    }
+  }
+  return hits;
+}
@@ -461,8 +461,20 @@ MatrixType bitsetToMatrix(const std::bitset<MatrixType::RowsAtCompileTime *
 
   MatrixType m;
   auto* p = m.data();
-  for (size_t i = 0; i < rows * cols; i++) {
-    p[i] = bs[rows * cols - 1 - i];
+  if constexpr (rows * cols <= 64) {
+    // decode from a single word and stop after the highest set bit,
+    // since e.g. projection matrices are mostly zero
+    m.setZero();
+    unsigned long long bits = bs.to_ullong();
+    for (int bit = 0; bits != 0; ++bit, bits >>= 1) {
+      if ((bits & 1u) != 0) {
+        p[rows * cols - 1 - bit] = 1;
+      }
+    }
+  } else {
+    for (size_t i = 0; i < rows * cols; i++) {
+      p[i] = bs[rows * cols - 1 - i];
+    }
   }
   return m;
 }
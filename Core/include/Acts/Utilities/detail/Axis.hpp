@@ -113,6 +113,7 @@ class Axis<AxisType::Equidistant, bdt> final : public IAxis {
       : m_min(xmin),
         m_max(xmax),
         m_width((xmax - xmin) / nBins),
+        m_invWidth(nBins / (xmax - xmin)),
         m_bins(nBins) {}
 
   /// @brief returns whether the axis is equidistant
@@ -280,8 +281,36 @@ class Axis<AxisType::Equidistant, bdt> final : public IAxis {
   ///       bin with lower bound @c l and upper bound @c u.
   /// @note Bin indices start at @c 1. The underflow bin has the index @c 0
   ///       while the index <tt>nBins + 1</tt> indicates the overflow bin .
+  ///
+  /// @note The boundary type is resolved at compile time and the bin index
+  ///       is clamped before the conversion to an integer, hence there is
+  ///       no branch for the open and bound axes.
+  /// @note The coordinate is multiplied with the precomputed inverse bin
+  ///       width, for values within rounding precision of a bin edge the
+  ///       bin may differ from a division by the bin width.
   size_t getBin(double x) const {
-    return wrapBin(std::floor((x - getMin()) / getBinWidth()) + 1);
+    return getBinImpl(x, m_min, m_invWidth, static_cast<long>(m_bins));
+  }
+
+  /// @brief get corresponding bin indices for many coordinates
+  ///
+  /// @param  [in] x input coordinates
+  /// @param  [out] bins indices of the bins containing the given values,
+  ///                    resized to the number of input coordinates
+  ///
+  /// @note The loop body is the same as for getBin() and can be
+  ///       vectorized by the compiler for the open and bound axes.
+  void getBins(const std::vector<double>& x, std::vector<size_t>& bins) const {
+    bins.resize(x.size());
+    // local copies, the output could otherwise alias the number of bins
+    const double min = m_min;
+    const double invWidth = m_invWidth;
+    const auto nBins = static_cast<long>(m_bins);
+    const double* xs = x.data();
+    size_t* bs = bins.data();
+    for (size_t i = 0; i < x.size(); ++i) {
+      bs[i] = getBinImpl(xs[i], min, invWidth, nBins);
+    }
   }
 
   /// @brief get bin width
@@ -370,8 +399,58 @@ class Axis<AxisType::Equidistant, bdt> final : public IAxis {
   double m_max;
   /// constant bin width
   double m_width;
+  /// inverse of the constant bin width
+  double m_invWidth;
   /// number of bins (excluding under-/overflow bins)
   size_t m_bins;
+
+  /// Bin index for Open: clamped to [0, nBins+1]
+  ///
+  /// The bin index is first clamped as floating point value to a range
+  /// which is safe for the conversion, out-of-range and NaN values end up
+  /// in the under-/overflow bins. The truncation is the floor for all
+  /// values which are not clamped to the lower bound afterwards. The lower
+  /// bound depends on the number of bins, which keeps the compiler from
+  /// introducing a branch for the constant result.
+  template <AxisBoundaryType T = bdt,
+            std::enable_if_t<T == AxisBoundaryType::Open, int> = 0>
+  static size_t getBinImpl(double x, double min, double invWidth,
+                           long nBins) {
+    const double bin = (x - min) * invWidth + 1.;
+    const double max = static_cast<double>(nBins + 1);
+    const auto clamped = static_cast<long>(std::max(-max, std::min(bin, max)));
+    return std::max(clamped, 0l);
+  }
+
+  /// Bin index for Bound: clamped to [1, nBins]
+  template <AxisBoundaryType T = bdt,
+            std::enable_if_t<T == AxisBoundaryType::Bound, int> = 0>
+  static size_t getBinImpl(double x, double min, double invWidth,
+                           long nBins) {
+    const double bin = (x - min) * invWidth + 1.;
+    const double max = static_cast<double>(nBins);
+    const auto clamped = static_cast<long>(std::max(-max, std::min(bin, max)));
+    return std::max(clamped, 1l);
+  }
+
+  /// Bin index for Closed: wrapped around to the other side
+  ///
+  /// Values within one period outside of the range are wrapped without a
+  /// division, others fall back to the floating point modulo.
+  template <AxisBoundaryType T = bdt,
+            std::enable_if_t<T == AxisBoundaryType::Closed, int> = 0>
+  static size_t getBinImpl(double x, double min, double invWidth,
+                           long nBins) {
+    const double period = static_cast<double>(nBins);
+    // shift by one period to have a non-negative value for the truncation
+    double shifted = (x - min) * invWidth + period;
+    if (not(shifted >= 0. and shifted < 3 * period)) {
+      shifted = std::fmod(shifted, period);
+      shifted += (shifted < 0.) ? period : 0.;
+    }
+    const auto bin = static_cast<long>(shifted);
+    return bin - nBins * ((bin >= nBins) + (bin >= 2 * nBins)) + 1;
+  }
 };
 
 /// @brief calculate bin indices for a variable binning
@@ -0,0 +1,81 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Acts {
+namespace detail {
+
+/// Evaluate a function for the indices [0, n), optionally concurrently
+///
+/// The indices are split into contiguous blocks, one per task, the first
+/// block is evaluated on the calling thread. The results are stored in
+/// index order, hence they do not depend on the number of threads or the
+/// scheduling. Exceptions are rethrown on the calling thread.
+///
+/// @tparam function_t The callable type, `result_t(size_t)`, where the
+///         result only needs to be move constructible
+///
+/// @param n The number of indices
+/// @param nThreads The maximal number of concurrent tasks, 0 and 1 evaluate
+///        sequentially on the calling thread
+/// @param function The callable, must be safe to call concurrently
+///
+/// @return the results in index order
+template <typename function_t>
+auto parallelMap(size_t n, size_t nThreads, function_t&& function)
+    -> std::vector<std::decay_t<decltype(function(size_t(0)))>> {
+  using result_t = std::decay_t<decltype(function(size_t(0)))>;
+  std::vector<std::optional<result_t>> evaluated(n);
+  auto evaluate = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      evaluated[i].emplace(function(i));
+    }
+  };
+  nThreads = std::clamp<size_t>(nThreads, 1, std::max<size_t>(n, 1));
+  const size_t blockSize = (n + nThreads - 1) / nThreads;
+  std::vector<std::future<void>> blocks;
+  for (size_t begin = blockSize; begin < n; begin += blockSize) {
+    blocks.push_back(std::async(std::launch::async, evaluate, begin,
+                                std::min(begin + blockSize, n)));
+  }
+  // the waiting on the other blocks must not be skipped by an exception
+  std::exception_ptr failure = nullptr;
+  try {
+    evaluate(0, std::min(blockSize, n));
+  } catch (...) {
+    failure = std::current_exception();
+  }
+  for (auto& block : blocks) {
+    try {
+      block.get();
+    } catch (...) {
+      if (failure == nullptr) {
+        failure = std::current_exception();
+      }
+    }
+  }
+  if (failure != nullptr) {
+    std::rethrow_exception(failure);
+  }
+  std::vector<result_t> results;
+  results.reserve(n);
+  for (auto& result : evaluated) {
+    results.push_back(std::move(*result));
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace Acts
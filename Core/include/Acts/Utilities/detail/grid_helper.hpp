@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <boost/container/static_vector.hpp>
 #include <array>
 #include <tuple>
 #include <utility>
@@ -129,6 +130,18 @@ class GlobalNeighborHoodIndices {
     return result;
   }
 
+  // Collect the sequence of indices into a container of fixed capacity N,
+  // which lives on the stack. The capacity must not be smaller than size(),
+  // e.g. (2 * size + 1)^DIM for a neighborhood of the given size.
+  template <size_t N>
+  boost::container::static_vector<size_t, N> collect() const {
+    boost::container::static_vector<size_t, N> result;
+    for (size_t idx : *this) {
+      result.push_back(idx);
+    }
+    return result;
+  }
+
  private:
   std::array<NeighborHoodIndices, DIM> m_localIndices;
   std::array<size_t, DIM - 1> m_globalStrides;
@@ -0,0 +1,33 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/AlignedDetectorElement.hpp"
+#include "Acts/Geometry/AlignmentStore.hpp"
+#include "Acts/Surfaces/PlanarBounds.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+
+Acts::AlignedDetectorElement::AlignedDetectorElement(
+    std::shared_ptr<const Transform3D> transform,
+    std::shared_ptr<const PlanarBounds> pBounds, double thickness)
+    : DetectorElementBase(),
+      m_nominalTransform(std::move(transform)),
+      m_thickness(thickness) {
+  m_surface = Surface::makeShared<PlaneSurface>(pBounds, *this);
+}
+
+const Acts::Transform3D& Acts::AlignedDetectorElement::transform(
+    const GeometryContext& gctx) const {
+  const AlignmentStore* store = AlignmentContext::find(gctx);
+  if (store != nullptr) {
+    const Transform3D* aligned = store->transform(m_surface->geoID());
+    if (aligned != nullptr) {
+      return *aligned;
+    }
+  }
+  return *m_nominalTransform;
+}
@@ -0,0 +1,30 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/AlignmentStore.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+Acts::AlignmentStore::AlignmentStore(std::vector<Entry> entries,
+                                     size_t version)
+    : m_version(version) {
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.first < b.first; });
+  std::vector<GeometryID> ids;
+  ids.reserve(entries.size());
+  m_transforms.reserve(entries.size());
+  for (auto& entry : entries) {
+    if (not ids.empty() and ids.back() == entry.first) {
+      throw std::invalid_argument("Duplicate identifier in alignment store");
+    }
+    ids.push_back(entry.first);
+    m_transforms.push_back(std::move(entry.second));
+  }
+  m_index = detail::GeometryIDIndex(std::move(ids));
+}
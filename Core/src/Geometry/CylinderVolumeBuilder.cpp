@@ -22,6 +22,7 @@
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/detail/ParallelMap.hpp"
 
 Acts::CylinderVolumeBuilder::CylinderVolumeBuilder(
     const Acts::CylinderVolumeBuilder::Config& cvbConfig,
@@ -68,12 +69,15 @@ Acts::CylinderVolumeBuilder::trackingVolume(
 
   // the layers are built by the layer builder
   if (m_cfg.layerBuilder) {
-    // the negative Layers
-    negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
-    // the central Layers
-    centralLayers = m_cfg.layerBuilder->centralLayers(gctx);
-    // the positive Layer
-    positiveLayers = m_cfg.layerBuilder->positiveLayers(gctx);
+    // the negative, central and positive layers are independent
+    auto layers = detail::parallelMap(3, m_cfg.nThreads, [&](size_t il) {
+      return (il == 0) ? m_cfg.layerBuilder->negativeLayers(gctx)
+                       : (il == 1) ? m_cfg.layerBuilder->centralLayers(gctx)
+                                   : m_cfg.layerBuilder->positiveLayers(gctx);
+    });
+    negativeLayers = std::move(layers[0]);
+    centralLayers = std::move(layers[1]);
+    positiveLayers = std::move(layers[2]);
   }
 
   // Build the confined volumes
@@ -197,18 +201,17 @@ Acts::CylinderVolumeBuilder::trackingVolume(
 
   // (C) VOLUME CREATION ----------------------------------
   auto tvHelper = m_cfg.trackingVolumeHelper;
-  // the barrel is always created
-  auto barrel =
-      wConfig.cVolumeConfig
-          ? tvHelper->createTrackingVolume(
-                gctx, wConfig.cVolumeConfig.layers,
-                wConfig.cVolumeConfig.volumes, m_cfg.volumeMaterial,
-                wConfig.cVolumeConfig.rMin, wConfig.cVolumeConfig.rMax,
-                wConfig.cVolumeConfig.zMin, wConfig.cVolumeConfig.zMax,
-                m_cfg.volumeName + "::Barrel")
-          : nullptr;
-
-  // Helper method to check for
+  // Helper method to create the barrel volume
+  auto createBarrel = [&]() -> MutableTrackingVolumePtr {
+    return wConfig.cVolumeConfig
+               ? tvHelper->createTrackingVolume(
+                     gctx, wConfig.cVolumeConfig.layers,
+                     wConfig.cVolumeConfig.volumes, m_cfg.volumeMaterial,
+                     wConfig.cVolumeConfig.rMin, wConfig.cVolumeConfig.rMax,
+                     wConfig.cVolumeConfig.zMin, wConfig.cVolumeConfig.zMax,
+                     m_cfg.volumeName + "::Barrel")
+               : nullptr;
+  };
 
   // Helper method to create endcap volume
   auto createEndcap =
@@ -329,13 +332,22 @@ Acts::CylinderVolumeBuilder::trackingVolume(
         endcapConfig.zMax, m_cfg.volumeName + endcapName);
   };
 
-  // The negative endcap is created if present
-  auto nEndcap = createEndcap(wConfig.cVolumeConfig, wConfig.nVolumeConfig,
-                              "::NegativeEndcap");
-
-  // The positive endcap is created if present
-  auto pEndcap = createEndcap(wConfig.cVolumeConfig, wConfig.pVolumeConfig,
-                              "::PositiveEndcap");
+  // The barrel is always created, the endcaps if present. They only share
+  // the confined volumes, which are connected to each of them, hence they
+  // are only built concurrently without confined volumes
+  size_t nVolumeThreads =
+      wConfig.cVolumeConfig.volumes.empty() ? m_cfg.nThreads : 1;
+  auto subVolumes = detail::parallelMap(3, nVolumeThreads, [&](size_t iv) {
+    return (iv == 0) ? createEndcap(wConfig.cVolumeConfig,
+                                    wConfig.nVolumeConfig, "::NegativeEndcap")
+                     : (iv == 1) ? createBarrel()
+                                 : createEndcap(wConfig.cVolumeConfig,
+                                                wConfig.pVolumeConfig,
+                                                "::PositiveEndcap");
+  });
+  auto nEndcap = subVolumes[0];
+  auto barrel = subVolumes[1];
+  auto pEndcap = subVolumes[2];
 
   ACTS_DEBUG("Newly created volume(s) will be " << wConfig.wConditionScreen);
   // Standalone container, full wrapping, full insertion & if no existing volume
@@ -0,0 +1,86 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/GeometryCache.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <future>
+
+namespace {
+std::vector<const Acts::Surface*> collectSurfaces(
+    const Acts::TrackingGeometry& tGeometry) {
+  std::vector<const Acts::Surface*> surfaces;
+  tGeometry.visitSurfaces([&surfaces](const Acts::Surface* surface) {
+    surfaces.push_back(surface);
+  });
+  return surfaces;
+}
+}  // namespace
+
+Acts::GeometryCache::GeometryCache(const GeometryContext& gctx,
+                                   const TrackingGeometry& tGeometry,
+                                   size_t nThreads)
+    : GeometryCache(gctx, collectSurfaces(tGeometry), nThreads) {}
+
+Acts::GeometryCache::GeometryCache(const GeometryContext& gctx,
+                                   std::vector<const Surface*> surfaces,
+                                   size_t nThreads)
+    : m_surfaces(std::move(surfaces)) {
+  // keep the sensitive surfaces & order them by identifier
+  m_surfaces.erase(std::remove_if(m_surfaces.begin(), m_surfaces.end(),
+                                  [](const Surface* surface) {
+                                    return surface == nullptr or
+                                           surface->geoID().sensitive() == 0;
+                                  }),
+                   m_surfaces.end());
+  std::sort(m_surfaces.begin(), m_surfaces.end(),
+            [](const Surface* a, const Surface* b) {
+              return a->geoID() < b->geoID();
+            });
+  std::vector<GeometryID> ids;
+  ids.reserve(m_surfaces.size());
+  for (const auto& surface : m_surfaces) {
+    ids.push_back(surface->geoID());
+  }
+  m_index = detail::GeometryIDIndex(std::move(ids));
+
+  // evaluate the transforms, each thread fills a contiguous block
+  m_transforms.resize(m_surfaces.size());
+  m_inverseTransforms.resize(m_surfaces.size());
+  m_columns.resize(m_surfaces.size());
+  auto evaluate = [&](size_t begin, size_t end) {
+    for (size_t is = begin; is < end; ++is) {
+      m_transforms[is] = m_surfaces[is]->transform(gctx);
+      m_inverseTransforms[is] = m_transforms[is].inverse();
+      m_columns.set(is, m_transforms[is]);
+    }
+  };
+  nThreads = std::max(nThreads, size_t(1));
+  const size_t nSurfaces = m_surfaces.size();
+  const size_t blockSize = (nSurfaces + nThreads - 1) / nThreads;
+  std::vector<std::future<void>> blocks;
+  for (size_t begin = blockSize; begin < nSurfaces; begin += blockSize) {
+    blocks.push_back(std::async(std::launch::async, evaluate, begin,
+                                std::min(begin + blockSize, nSurfaces)));
+  }
+  evaluate(0, std::min(blockSize, nSurfaces));
+  for (auto& block : blocks) {
+    block.get();
+  }
+}
+
+uint32_t Acts::GeometryCache::slot(const Surface& surface) const {
+  // only sensitive surfaces are cached
+  if (surface.geoID().sensitive() == 0) {
+    return npos;
+  }
+  uint32_t islot = m_index.find(surface.geoID());
+  return (islot != npos and m_surfaces[islot] == &surface) ? islot : npos;
+}
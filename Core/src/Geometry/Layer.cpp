@@ -95,5 +95,7 @@ void Acts::Layer::closeGeometry(const IMaterialDecorator* materialDecorator,
         m_ssSensitiveSurfaces = 2;
       }
     }
+    // batch the planar sensitive surfaces for the intersection
+    m_sensitiveBatch = PlaneSurfaceBatch(m_surfaceArray->surfaces());
   }
 }
@@ -388,6 +388,80 @@ Acts::SurfaceArrayCreator::surfaceArrayOnPlane(
   //!< @todo implement - take from ATLAS complex TRT builder
 }
 
+std::unique_ptr<Acts::SurfaceArray>
+Acts::SurfaceArrayCreator::surfaceArrayOnGrid(
+    const GeometryContext& gctx,
+    std::vector<std::shared_ptr<const Surface>> surfaces,
+    const ProtoAxis& pAxisA, const ProtoAxis& pAxisB,
+    const std::vector<std::vector<size_t>>& binContent, double layerValue,
+    const std::shared_ptr<const Transform3D>& transformOpt) const {
+  ACTS_VERBOSE("Creating a SurfaceArray on a given grid");
+  ACTS_VERBOSE(" -- with " << surfaces.size() << " surfaces.")
+  ACTS_VERBOSE(" -- with " << pAxisA.nBins << " x " << pAxisB.nBins << " = "
+                           << pAxisA.nBins * pAxisB.nBins << " bins.");
+
+  Transform3D transform =
+      transformOpt != nullptr ? *transformOpt : Transform3D::Identity();
+  Transform3D itransform = transform.inverse();
+
+  std::unique_ptr<SurfaceArray::ISurfaceGridLookup> sl;
+  if (pAxisA.bValue == binPhi and pAxisB.bValue == binZ) {
+    auto globalToLocal = [transform](const Vector3D& pos) {
+      Vector3D loc = transform * pos;
+      return Vector2D(phi(loc), loc.z());
+    };
+    auto localToGlobal = [itransform, layerValue](const Vector2D& loc) {
+      return itransform * Vector3D(layerValue * std::cos(loc[0]),
+                                   layerValue * std::sin(loc[0]), loc[1]);
+    };
+    sl = makeSurfaceGridLookup2D<detail::AxisBoundaryType::Closed,
+                                 detail::AxisBoundaryType::Bound>(
+        globalToLocal, localToGlobal, pAxisA, pAxisB);
+  } else if (pAxisA.bValue == binR and pAxisB.bValue == binPhi) {
+    auto globalToLocal = [transform](const Vector3D& pos) {
+      Vector3D loc = transform * pos;
+      return Vector2D(perp(loc), phi(loc));
+    };
+    auto localToGlobal = [itransform, layerValue](const Vector2D& loc) {
+      return itransform * Vector3D(loc[0] * std::cos(loc[1]),
+                                   loc[0] * std::sin(loc[1]), layerValue);
+    };
+    sl = makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
+                                 detail::AxisBoundaryType::Closed>(
+        globalToLocal, localToGlobal, pAxisA, pAxisB);
+  } else {
+    auto globalToLocal = [transform](const Vector3D& pos) {
+      Vector3D loc = transform * pos;
+      return Vector2D(loc.x(), loc.y());
+    };
+    auto localToGlobal = [itransform](const Vector2D& loc) {
+      return itransform * Vector3D(loc.x(), loc.y(), 0.);
+    };
+    sl = makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
+                                 detail::AxisBoundaryType::Bound>(
+        globalToLocal, localToGlobal, pAxisA, pAxisB);
+  }
+
+  if (binContent.size() != sl->size()) {
+    throw std::invalid_argument(
+        "Acts::SurfaceArrayCreator::surfaceArrayOnGrid: bin content does not "
+        "match the grid size");
+  }
+  for (size_t bin = 0; bin < binContent.size(); ++bin) {
+    SurfaceVector& content = sl->lookup(bin);
+    content.reserve(binContent[bin].size());
+    for (size_t isf : binContent[bin]) {
+      content.push_back(surfaces.at(isf).get());
+    }
+  }
+  // filling no further surfaces only builds the neighbor cache
+  sl->fill(gctx, {});
+
+  return std::make_unique<SurfaceArray>(
+      std::move(sl), std::move(surfaces),
+      std::make_shared<const Transform3D>(transform));
+}
+
 std::vector<const Acts::Surface*> Acts::SurfaceArrayCreator::findKeySurfaces(
     const std::vector<const Surface*>& surfaces,
     const std::function<bool(const Surface*, const Surface*)>& equal) const {
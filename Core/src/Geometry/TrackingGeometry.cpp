@@ -10,8 +10,12 @@
 // TrackingGeometry.cpp, Acts project
 ///////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 
+#include "Acts/Geometry/AbstractVolume.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
 #include "Acts/Geometry/Layer.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
@@ -26,6 +30,10 @@ Acts::TrackingGeometry::TrackingGeometry(
   // Close the geometry: assign geometryID and successively the material
   size_t volumeID = 0;
   highestVolume->closeGeometry(materialDecorator, m_trackingVolumes, volumeID);
+  // Build the point-location index on the closed geometry
+  buildVolumeLookup();
+  // Build the identifier lookup on the closed geometry
+  buildGeometryIDIndex();
 }
 
 Acts::TrackingGeometry::~TrackingGeometry() = default;
@@ -33,6 +41,21 @@ Acts::TrackingGeometry::~TrackingGeometry() = default;
 const Acts::TrackingVolume* Acts::TrackingGeometry::lowestTrackingVolume(
     const GeometryContext& gctx, const Acts::Vector3D& gp) const {
   const TrackingVolume* searchVolume = m_world.get();
+  // Start from the deepest volume known to confine the grid cell
+  if (!m_volumeLookup.empty()) {
+    size_t cell = 0;
+    for (size_t i = 0; i < 3; ++i) {
+      double u = (gp[i] - m_lookupMin[i]) * m_lookupInvCellSize[i];
+      if (not(u >= 0. and u < m_lookupBins[i])) {
+        cell = m_volumeLookup.size();
+        break;
+      }
+      cell = cell * m_lookupBins[i] + static_cast<size_t>(u);
+    }
+    if (cell < m_volumeLookup.size()) {
+      searchVolume = m_volumeLookup[cell];
+    }
+  }
   const TrackingVolume* currentVolume = nullptr;
   while (currentVolume != searchVolume && (searchVolume != nullptr)) {
     currentVolume = searchVolume;
@@ -75,3 +98,190 @@ void Acts::TrackingGeometry::visitSurfaces(
     const std::function<void(const Acts::Surface*)>& visitor) const {
   highestTrackingVolume()->visitSurfaces(visitor);
 }
+
+const Acts::Surface* Acts::TrackingGeometry::findSurface(
+    GeometryID geoID) const {
+  uint32_t position = m_surfaceIndex.find(geoID);
+  return (position == detail::GeometryIDIndex::npos) ? nullptr
+                                                     : m_surfaces[position];
+}
+
+const Acts::Layer* Acts::TrackingGeometry::findLayer(GeometryID geoID) const {
+  uint32_t position = m_layerIndex.find(geoID);
+  return (position == detail::GeometryIDIndex::npos) ? nullptr
+                                                     : m_layers[position];
+}
+
+const Acts::TrackingVolume* Acts::TrackingGeometry::findVolume(
+    GeometryID geoID) const {
+  uint32_t position = m_volumeIndex.find(geoID);
+  return (position == detail::GeometryIDIndex::npos) ? nullptr
+                                                     : m_volumes[position];
+}
+
+const std::vector<const Acts::Surface*>& Acts::TrackingGeometry::surfaces()
+    const {
+  return m_surfaces;
+}
+
+void Acts::TrackingGeometry::buildGeometryIDIndex() {
+  std::vector<std::pair<GeometryID, const Surface*>> surfaces;
+  std::vector<std::pair<GeometryID, const Layer*>> layers;
+  std::vector<std::pair<GeometryID, const TrackingVolume*>> volumes;
+  auto addSurface = [&](const Surface* surface) {
+    if (surface != nullptr and surface->geoID().value() != 0) {
+      surfaces.emplace_back(surface->geoID(), surface);
+    }
+  };
+  std::function<void(const TrackingVolume*)> collect =
+      [&](const TrackingVolume* volume) {
+        volumes.emplace_back(volume->geoID(), volume);
+        for (const auto& bSurface : volume->boundarySurfaces()) {
+          addSurface(&bSurface->surfaceRepresentation());
+        }
+        if (volume->confinedLayers() != nullptr) {
+          for (const auto& layer : volume->confinedLayers()->arrayObjects()) {
+            layers.emplace_back(layer->geoID(), layer.get());
+            addSurface(&layer->surfaceRepresentation());
+            if (layer->approachDescriptor() != nullptr) {
+              for (const auto& aSurface :
+                   layer->approachDescriptor()->containedSurfaces()) {
+                addSurface(aSurface);
+              }
+            }
+            if (layer->surfaceArray() != nullptr) {
+              for (const auto& sSurface : layer->surfaceArray()->surfaces()) {
+                addSurface(sSurface);
+              }
+            }
+          }
+        }
+        for (const auto& descendant : volume->descendantVolumes()) {
+          auto avol = dynamic_cast<const AbstractVolume*>(descendant.get());
+          if (avol != nullptr) {
+            for (const auto& bSurface : avol->boundarySurfaces()) {
+              addSurface(&bSurface->surfaceRepresentation());
+            }
+          }
+        }
+        if (volume->confinedVolumes()) {
+          for (const auto& child : volume->confinedVolumes()->arrayObjects()) {
+            collect(child.get());
+          }
+        }
+        for (const auto& dense : volume->denseVolumes()) {
+          collect(dense.get());
+        }
+      };
+  collect(m_world.get());
+
+  // Sort by identifier, objects reached several times (e.g. shared boundary
+  // surfaces or layers in several bins) are kept once
+  auto build = [](auto& entries, auto& objects) {
+    std::sort(entries.begin(), entries.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    entries.erase(std::unique(entries.begin(), entries.end(),
+                              [](const auto& a, const auto& b) {
+                                return a.first == b.first;
+                              }),
+                  entries.end());
+    std::vector<GeometryID> ids;
+    ids.reserve(entries.size());
+    objects.reserve(entries.size());
+    for (const auto& entry : entries) {
+      ids.push_back(entry.first);
+      objects.push_back(entry.second);
+    }
+    return detail::GeometryIDIndex(std::move(ids));
+  };
+  m_surfaceIndex = build(surfaces, m_surfaces);
+  m_layerIndex = build(layers, m_layers);
+  m_volumeIndex = build(volumes, m_volumes);
+}
+
+void Acts::TrackingGeometry::buildVolumeLookup() {
+  // Collect the lowest volumes together with their chain of mother volumes
+  std::vector<std::vector<const TrackingVolume*>> chains;
+  std::vector<const TrackingVolume*> chain;
+  std::function<void(const TrackingVolume*)> collect =
+      [&](const TrackingVolume* volume) {
+        chain.push_back(volume);
+        auto confined = volume->confinedVolumes();
+        if (confined) {
+          for (const auto& child : confined->arrayObjects()) {
+            collect(child.get());
+          }
+        } else {
+          chains.push_back(chain);
+        }
+        chain.pop_back();
+      };
+  collect(m_world.get());
+  // Nothing to be gained for a single volume
+  if (chains.size() < 2) {
+    return;
+  }
+
+  // Regular grid over the world extent, finer for more volumes
+  auto worldBox = m_world->boundingBox();
+  size_t nBins = static_cast<size_t>(
+      std::ceil(4. * std::cbrt(static_cast<double>(chains.size()))));
+  nBins = std::clamp<size_t>(nBins, 8, 64);
+  m_lookupMin = worldBox.min();
+  for (size_t i = 0; i < 3; ++i) {
+    double extent = worldBox.max()[i] - worldBox.min()[i];
+    if (extent <= 0.) {
+      m_lookupBins = {{0, 0, 0}};
+      return;
+    }
+    m_lookupBins[i] = nBins;
+    m_lookupInvCellSize[i] = nBins / extent;
+  }
+
+  // Every cell keeps the common part of the chains of all volumes touching it
+  // as (index of a representative chain, depth of the common part)
+  const size_t nCells = m_lookupBins[0] * m_lookupBins[1] * m_lookupBins[2];
+  std::vector<std::pair<size_t, size_t>> cells(nCells, {chains.size(), 0});
+  const Vector3D envelope(s_onSurfaceTolerance, s_onSurfaceTolerance,
+                          s_onSurfaceTolerance);
+  for (size_t ic = 0; ic < chains.size(); ++ic) {
+    auto box = chains[ic].back()->boundingBox(envelope);
+    std::array<size_t, 3> lower, upper;
+    for (size_t i = 0; i < 3; ++i) {
+      double lu = (box.min()[i] - m_lookupMin[i]) * m_lookupInvCellSize[i];
+      double uu = (box.max()[i] - m_lookupMin[i]) * m_lookupInvCellSize[i];
+      lower[i] = static_cast<size_t>(std::max(lu, 0.));
+      upper[i] = std::min(static_cast<size_t>(std::max(uu, 0.)),
+                          m_lookupBins[i] - 1);
+    }
+    for (size_t ix = lower[0]; ix <= upper[0]; ++ix) {
+      for (size_t iy = lower[1]; iy <= upper[1]; ++iy) {
+        for (size_t iz = lower[2]; iz <= upper[2]; ++iz) {
+          auto& cell =
+              cells[(ix * m_lookupBins[1] + iy) * m_lookupBins[2] + iz];
+          if (cell.first == chains.size()) {
+            cell = {ic, chains[ic].size()};
+            continue;
+          }
+          const auto& cellChain = chains[cell.first];
+          size_t depth = 0;
+          while (depth < cell.second and depth < chains[ic].size() and
+                 cellChain[depth] == chains[ic][depth]) {
+            ++depth;
+          }
+          cell.second = depth;
+        }
+      }
+    }
+  }
+
+  // Cells not touched by any volume start from the world
+  m_volumeLookup.reserve(nCells);
+  for (const auto& cell : cells) {
+    if (cell.first == chains.size() or cell.second == 0) {
+      m_volumeLookup.push_back(m_world.get());
+    } else {
+      m_volumeLookup.push_back(chains[cell.first][cell.second - 1]);
+    }
+  }
+}
@@ -0,0 +1,1433 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+///////////////////////////////////////////////////////////////////
+// TrackingGeometrySnapshot.cpp, Acts project
+///////////////////////////////////////////////////////////////////
+
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/ConeLayer.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CutoutCylinderVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderLayer.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/DetectorElementBase.hpp"
+#include "Acts/Geometry/DiscLayer.hpp"
+#include "Acts/Geometry/GenericApproachDescriptor.hpp"
+#include "Acts/Geometry/GenericCuboidVolumeBounds.hpp"
+#include "Acts/Geometry/NavigationLayer.hpp"
+#include "Acts/Geometry/PlaneLayer.hpp"
+#include "Acts/Geometry/SurfaceArrayCreator.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+
+namespace {
+
+using namespace Acts;
+
+/// Identification of the snapshot format
+constexpr char s_magic[8] = {'A', 'C', 'T', 'S', 'G', 'E', 'O', '\0'};
+constexpr uint32_t s_version = 1;
+
+/// Marker for missing references
+constexpr uint32_t s_none = std::numeric_limits<uint32_t>::max();
+
+/// Contiguous entries in one of the pools or sections
+struct Range {
+  uint32_t offset = 0;
+  uint32_t size = 0;
+};
+
+/// Affine transform, the upper 3x4 block of the matrix in column major order
+using TransformRecord = std::array<double, 12>;
+
+/// The sections of the snapshot, in the order of the section table
+enum Section : uint32_t {
+  eVolumes = 0,
+  eBoundaries = 1,
+  eLayers = 2,
+  eSurfaces = 3,
+  eMaterials = 4,
+  eBinUtilities = 5,
+  eBinningData = 6,
+  eArrays = 7,
+  eDoubles = 8,
+  eIndices = 9,
+  eChars = 10,
+  eNumSections = 11
+};
+
+struct SectionRecord {
+  uint64_t offset = 0;
+  uint64_t count = 0;
+};
+
+struct HeaderRecord {
+  char magic[8] = {};
+  uint32_t version = s_version;
+  uint32_t nSections = eNumSections;
+  SectionRecord sections[eNumSections];
+};
+
+struct VolumeRecord {
+  uint64_t geoID = 0;
+  int32_t boundsType = VolumeBounds::eOther;
+  uint32_t material = s_none;
+  Range boundsValues;
+  Range name;
+  // the layer and volume arrays
+  uint32_t layers = s_none;
+  uint32_t volumes = s_none;
+  Range denseVolumes;
+  // one boundary per face
+  Range boundaries;
+  TransformRecord transform = {};
+};
+
+struct BoundaryRecord {
+  uint32_t surface = s_none;
+  uint32_t inside = s_none;
+  uint32_t outside = s_none;
+  uint32_t insideArray = s_none;
+  uint32_t outsideArray = s_none;
+  uint32_t padding = 0;
+};
+
+struct AxisRecord {
+  uint32_t equidistant = 1;
+  uint32_t nBins = 0;
+  double min = 0.;
+  double max = 0.;
+  Range edges;
+};
+
+struct LayerRecord {
+  uint64_t geoID = 0;
+  int32_t layerType = passive;
+  uint32_t navigation = 0;
+  // the layer takes transform, bounds and material of its representation
+  uint32_t representation = s_none;
+  // dimension of the surface array, s_none without surface array
+  uint32_t dimensions = s_none;
+  double thickness = 0.;
+  Range approach;
+  Range sensitive;
+  // bin offsets into the bin content, one more than the number of bins
+  Range binOffsets;
+  Range binContent;
+  AxisRecord axes[2];
+  TransformRecord arrayTransform = {};
+};
+
+struct SurfaceRecord {
+  uint64_t geoID = 0;
+  int32_t type = Surface::Other;
+  int32_t boundsType = SurfaceBounds::eOther;
+  Range boundsValues;
+  uint32_t material = s_none;
+  uint32_t detectorElement = 0;
+  TransformRecord transform = {};
+};
+
+enum MaterialType : uint32_t {
+  eHomogeneousSurface = 0,
+  eBinnedSurface = 1,
+  eProtoSurface = 2,
+  eHomogeneousVolume = 3
+};
+
+/// Material properties are stored as X0, L0, Ar, Z, rho and thickness,
+/// the volume material without thickness
+constexpr size_t s_propertiesSize = 6;
+
+struct MaterialRecord {
+  uint32_t type = eHomogeneousSurface;
+  uint32_t binUtility = s_none;
+  uint32_t bins0 = 1;
+  uint32_t bins1 = 1;
+  Range values;
+  double splitFactor = 1.;
+};
+
+struct BinUtilityRecord {
+  Range binningData;
+  uint32_t hasTransform = 0;
+  uint32_t padding = 0;
+  TransformRecord transform = {};
+};
+
+struct BinningDataRecord {
+  int32_t type = equidistant;
+  int32_t option = open;
+  int32_t value = binX;
+  uint32_t zdim = 0;
+  uint32_t bins = 1;
+  uint32_t padding = 0;
+  double min = 0.;
+  double max = 0.;
+  Range boundaries;
+};
+
+struct ArrayRecord {
+  uint32_t binUtility = s_none;
+  // bins in loc0, loc1, loc2 of the object grid
+  uint32_t bins[3] = {1, 1, 1};
+  // object indices of the grid, ordered as [loc2][loc1][loc0]
+  Range grid;
+  Range objects;
+};
+
+/// Size of the entries of each section
+constexpr std::array<size_t, eNumSections> s_entrySizes = {
+    sizeof(VolumeRecord),     sizeof(BoundaryRecord),
+    sizeof(LayerRecord),      sizeof(SurfaceRecord),
+    sizeof(MaterialRecord),   sizeof(BinUtilityRecord),
+    sizeof(BinningDataRecord), sizeof(ArrayRecord),
+    sizeof(double),           sizeof(uint32_t),
+    sizeof(char)};
+
+TransformRecord transformRecord(const Transform3D& transform) {
+  TransformRecord record;
+  Eigen::Map<Eigen::Matrix<double, 3, 4>>(record.data()) =
+      transform.matrix().block<3, 4>(0, 0);
+  return record;
+}
+
+std::shared_ptr<const Transform3D> restoreTransform(
+    const TransformRecord& record) {
+  Transform3D transform = Transform3D::Identity();
+  transform.matrix().block<3, 4>(0, 0) =
+      Eigen::Map<const Eigen::Matrix<double, 3, 4>>(record.data());
+  return std::make_shared<const Transform3D>(transform);
+}
+
+[[noreturn]] void unsupported(const std::string& what) {
+  throw std::invalid_argument(
+      "Acts::TrackingGeometrySnapshot::write: unsupported " + what);
+}
+
+[[noreturn]] void corrupt(const std::string& what) {
+  throw std::invalid_argument(
+      "Acts::TrackingGeometrySnapshot::read: corrupt snapshot, " + what);
+}
+
+/// Collects the records of a tracking geometry
+class SnapshotWriter {
+ public:
+  SnapshotWriter(const GeometryContext& gctx) : m_gctx(gctx) {}
+
+  /// Write the volume hierarchy and then the boundaries of all volumes
+  void addWorld(const TrackingVolume& world) {
+    addVolume(world);
+    for (size_t iv = 0; iv < m_volumePtrs.size(); ++iv) {
+      std::vector<uint32_t> boundaries;
+      for (const auto& bs : m_volumePtrs[iv]->boundarySurfaces()) {
+        boundaries.push_back(addBoundary(*bs));
+      }
+      m_volumes[iv].boundaries = addIndices(boundaries);
+    }
+  }
+
+  /// Serialize all records into one buffer
+  std::vector<char> serialize() const {
+    HeaderRecord header;
+    std::copy(std::begin(s_magic), std::end(s_magic), header.magic);
+    std::vector<char> buffer(sizeof(HeaderRecord));
+    append(buffer, header.sections[eVolumes], m_volumes);
+    append(buffer, header.sections[eBoundaries], m_boundaries);
+    append(buffer, header.sections[eLayers], m_layers);
+    append(buffer, header.sections[eSurfaces], m_surfaces);
+    append(buffer, header.sections[eMaterials], m_materials);
+    append(buffer, header.sections[eBinUtilities], m_binUtilities);
+    append(buffer, header.sections[eBinningData], m_binningData);
+    append(buffer, header.sections[eArrays], m_arrays);
+    append(buffer, header.sections[eDoubles], m_doubles);
+    append(buffer, header.sections[eIndices], m_indices);
+    append(buffer, header.sections[eChars], m_chars);
+    std::memcpy(buffer.data(), &header, sizeof(HeaderRecord));
+    return buffer;
+  }
+
+  size_t nVolumes() const { return m_volumes.size(); }
+  size_t nLayers() const { return m_layers.size(); }
+  size_t nSurfaces() const { return m_surfaces.size(); }
+
+ private:
+  template <typename record_t>
+  static void append(std::vector<char>& buffer, SectionRecord& section,
+                     const std::vector<record_t>& records) {
+    static_assert(std::is_trivially_copyable<record_t>::value,
+                  "Records need to be trivially copyable");
+    section.offset = buffer.size();
+    section.count = records.size();
+    buffer.resize(buffer.size() + records.size() * sizeof(record_t));
+    if (not records.empty()) {
+      std::memcpy(buffer.data() + section.offset, records.data(),
+                  records.size() * sizeof(record_t));
+    }
+  }
+
+  template <typename value_t>
+  static Range addToPool(std::vector<value_t>& pool,
+                         const std::vector<value_t>& values) {
+    Range range;
+    range.offset = pool.size();
+    range.size = values.size();
+    pool.insert(pool.end(), values.begin(), values.end());
+    return range;
+  }
+
+  Range addDoubles(const std::vector<double>& values) {
+    return addToPool(m_doubles, values);
+  }
+
+  Range addIndices(const std::vector<uint32_t>& values) {
+    return addToPool(m_indices, values);
+  }
+
+  Range addString(const std::string& value) {
+    return addToPool(m_chars, std::vector<char>(value.begin(), value.end()));
+  }
+
+  void addProperties(std::vector<double>& values,
+                     const MaterialProperties& properties) {
+    ActsVectorF<5> numbers = properties.material().classificationNumbers();
+    values.insert(values.end(), numbers.data(), numbers.data() + 5);
+    values.push_back(properties.thickness());
+  }
+
+  uint32_t addBinUtility(const BinUtility& binUtility) {
+    BinUtilityRecord record;
+    std::vector<BinningDataRecord> binningData;
+    for (const auto& bd : binUtility.binningData()) {
+      if (bd.subBinningData != nullptr) {
+        unsupported("sub binning");
+      }
+      BinningDataRecord bdRecord;
+      bdRecord.type = bd.type;
+      bdRecord.option = bd.option;
+      bdRecord.value = bd.binvalue;
+      bdRecord.zdim = bd.zdim;
+      bdRecord.bins = bd.bins();
+      bdRecord.min = bd.min;
+      bdRecord.max = bd.max;
+      if (bd.type == arbitrary) {
+        const auto& boundaries = bd.boundaries();
+        bdRecord.boundaries =
+            addDoubles(std::vector<double>(boundaries.begin(),
+                                           boundaries.end()));
+      }
+      binningData.push_back(bdRecord);
+    }
+    record.binningData.offset = m_binningData.size();
+    record.binningData.size = binningData.size();
+    m_binningData.insert(m_binningData.end(), binningData.begin(),
+                         binningData.end());
+    if (binUtility.transform() != nullptr) {
+      record.hasTransform = 1;
+      record.transform = transformRecord(*binUtility.transform());
+    }
+    m_binUtilities.push_back(record);
+    return m_binUtilities.size() - 1;
+  }
+
+  uint32_t addSurfaceMaterial(const ISurfaceMaterial* material) {
+    if (material == nullptr) {
+      return s_none;
+    }
+    auto search = m_surfaceMaterialIndices.find(material);
+    if (search != m_surfaceMaterialIndices.end()) {
+      return search->second;
+    }
+    MaterialRecord record;
+    std::vector<double> values;
+    // the split factor is the one applied forward in the post update
+    record.splitFactor = material->factor(forward, postUpdate);
+    if (auto hsm = dynamic_cast<const HomogeneousSurfaceMaterial*>(material)) {
+      record.type = eHomogeneousSurface;
+      addProperties(values, hsm->materialProperties(0, 0));
+    } else if (auto bsm =
+                   dynamic_cast<const BinnedSurfaceMaterial*>(material)) {
+      record.type = eBinnedSurface;
+      record.binUtility = addBinUtility(bsm->binUtility());
+      const auto& matrix = bsm->fullMaterial();
+      record.bins1 = matrix.size();
+      record.bins0 = matrix.empty() ? 0 : matrix[0].size();
+      for (const auto& row : matrix) {
+        if (row.size() != record.bins0) {
+          unsupported("binned surface material with irregular bins");
+        }
+        for (const auto& properties : row) {
+          addProperties(values, properties);
+        }
+      }
+    } else if (auto psm = dynamic_cast<const ProtoSurfaceMaterial*>(material)) {
+      record.type = eProtoSurface;
+      record.binUtility = addBinUtility(psm->binUtility());
+    } else {
+      unsupported("surface material");
+    }
+    record.values = addDoubles(values);
+    m_materials.push_back(record);
+    m_surfaceMaterialIndices[material] = m_materials.size() - 1;
+    return m_materials.size() - 1;
+  }
+
+  uint32_t addVolumeMaterial(const IVolumeMaterial* material) {
+    if (material == nullptr) {
+      return s_none;
+    }
+    auto hvm = dynamic_cast<const HomogeneousVolumeMaterial*>(material);
+    if (hvm == nullptr) {
+      unsupported("volume material");
+    }
+    MaterialRecord record;
+    record.type = eHomogeneousVolume;
+    // homogeneous material does not depend on the position
+    ActsVectorF<5> numbers =
+        hvm->material(Vector3D(0., 0., 0.)).classificationNumbers();
+    record.values =
+        addDoubles(std::vector<double>(numbers.data(), numbers.data() + 5));
+    m_materials.push_back(record);
+    return m_materials.size() - 1;
+  }
+
+  uint32_t addSurface(const Surface& surface) {
+    auto search = m_surfaceIndices.find(&surface);
+    if (search != m_surfaceIndices.end()) {
+      return search->second;
+    }
+    if (surface.type() == Surface::Other) {
+      unsupported("surface type of " + surface.name());
+    }
+    SurfaceRecord record;
+    record.geoID = surface.geoID().value();
+    record.type = surface.type();
+    const SurfaceBounds& bounds = surface.bounds();
+    record.boundsType = bounds.type();
+    if (bounds.type() == SurfaceBounds::eTriangle or
+        bounds.type() == SurfaceBounds::eOther) {
+      unsupported("bounds of " + surface.name());
+    }
+    // bounds shared between surfaces are written once
+    auto bsearch = m_boundsValues.find(&bounds);
+    if (bsearch != m_boundsValues.end()) {
+      record.boundsValues = bsearch->second;
+    } else {
+      record.boundsValues = addDoubles(bounds.values());
+      m_boundsValues[&bounds] = record.boundsValues;
+    }
+    record.material = addSurfaceMaterial(surface.surfaceMaterial());
+    record.detectorElement = (surface.associatedDetectorElement() != nullptr);
+    record.transform = transformRecord(surface.transform(m_gctx));
+    m_surfaces.push_back(record);
+    m_surfaceIndices[&surface] = m_surfaces.size() - 1;
+    return m_surfaces.size() - 1;
+  }
+
+  void addAxis(AxisRecord& record, const IAxis& axis,
+               detail::AxisBoundaryType boundaryType) {
+    if (axis.getBoundaryType() != boundaryType) {
+      unsupported("surface array axis boundary type");
+    }
+    record.equidistant = axis.isEquidistant();
+    record.nBins = axis.getNBins();
+    record.min = axis.getMin();
+    record.max = axis.getMax();
+    if (not axis.isEquidistant()) {
+      record.edges = addDoubles(axis.getBinEdges());
+    }
+  }
+
+  void addSurfaceArray(LayerRecord& record, const SurfaceArray& surfaceArray,
+                       int representationType) {
+    // the sensitive surfaces and their position in the array
+    std::unordered_map<const Surface*, uint32_t> local;
+    std::vector<uint32_t> sensitive;
+    for (const Surface* surface : surfaceArray.surfaces()) {
+      local[surface] = sensitive.size();
+      sensitive.push_back(addSurface(*surface));
+    }
+    record.sensitive = addIndices(sensitive);
+
+    auto axes = surfaceArray.getAxes();
+    record.dimensions = axes.size();
+    if (axes.empty()) {
+      if (sensitive.size() != 1) {
+        unsupported("surface array without grid");
+      }
+      return;
+    }
+    if (axes.size() != 2) {
+      unsupported("surface array dimension");
+    }
+    using BT = detail::AxisBoundaryType;
+    if (representationType == Surface::Cylinder) {
+      addAxis(record.axes[0], *axes[0], BT::Closed);
+      addAxis(record.axes[1], *axes[1], BT::Bound);
+    } else if (representationType == Surface::Disc) {
+      addAxis(record.axes[0], *axes[0], BT::Bound);
+      addAxis(record.axes[1], *axes[1], BT::Closed);
+    } else if (representationType == Surface::Plane) {
+      addAxis(record.axes[0], *axes[0], BT::Bound);
+      addAxis(record.axes[1], *axes[1], BT::Bound);
+    } else {
+      unsupported("surface array on a cone layer");
+    }
+    record.arrayTransform = transformRecord(surfaceArray.transform());
+
+    std::vector<uint32_t> offsets = {0};
+    std::vector<uint32_t> content;
+    for (size_t bin = 0; bin < surfaceArray.size(); ++bin) {
+      for (const Surface* surface : surfaceArray.at(bin)) {
+        content.push_back(local.at(surface));
+      }
+      offsets.push_back(content.size());
+    }
+    record.binOffsets = addIndices(offsets);
+    record.binContent = addIndices(content);
+  }
+
+  uint32_t addLayer(const Layer& layer) {
+    LayerRecord record;
+    record.geoID = layer.geoID().value();
+    record.layerType = layer.layerType();
+    record.navigation =
+        (dynamic_cast<const NavigationLayer*>(&layer) != nullptr);
+    const Surface& representation = layer.surfaceRepresentation();
+    record.representation = addSurface(representation);
+    record.thickness = layer.thickness();
+    if (layer.approachDescriptor() != nullptr) {
+      std::vector<uint32_t> approach;
+      for (const Surface* surface :
+           layer.approachDescriptor()->containedSurfaces()) {
+        approach.push_back(addSurface(*surface));
+      }
+      record.approach = addIndices(approach);
+    }
+    if (layer.surfaceArray() != nullptr) {
+      addSurfaceArray(record, *layer.surfaceArray(), representation.type());
+    }
+    m_layers.push_back(record);
+    m_layerIndices[&layer] = m_layers.size() - 1;
+    return m_layers.size() - 1;
+  }
+
+  template <typename object_t, typename index_f>
+  uint32_t addArray(const BinnedArray<object_t>& array, index_f index) {
+    ArrayRecord record;
+    if (array.binUtility() != nullptr) {
+      record.binUtility = addBinUtility(*array.binUtility());
+    }
+    const auto& grid = array.objectGrid();
+    record.bins[2] = grid.size();
+    record.bins[1] = grid.empty() ? 0 : grid[0].size();
+    record.bins[0] = record.bins[1] == 0 ? 0 : grid[0][0].size();
+    std::vector<uint32_t> flat;
+    for (const auto& g1 : grid) {
+      if (g1.size() != record.bins[1]) {
+        unsupported("irregular binned array");
+      }
+      for (const auto& g0 : g1) {
+        if (g0.size() != record.bins[0]) {
+          unsupported("irregular binned array");
+        }
+        for (const auto& object : g0) {
+          flat.push_back(object != nullptr ? index(*object) : s_none);
+        }
+      }
+    }
+    record.grid = addIndices(flat);
+    std::vector<uint32_t> objects;
+    for (const auto& object : array.arrayObjects()) {
+      objects.push_back(index(*object));
+    }
+    record.objects = addIndices(objects);
+    m_arrays.push_back(record);
+    return m_arrays.size() - 1;
+  }
+
+  uint32_t volumeIndex(const TrackingVolume& volume) const {
+    auto search = m_volumeIndices.find(&volume);
+    if (search == m_volumeIndices.end()) {
+      unsupported("reference to a volume outside the hierarchy");
+    }
+    return search->second;
+  }
+
+  uint32_t addVolumeArray(const TrackingVolumeArray& array) {
+    auto search = m_volumeArrayIndices.find(&array);
+    if (search != m_volumeArrayIndices.end()) {
+      return search->second;
+    }
+    uint32_t index = addArray(array, [this](const TrackingVolume& volume) {
+      return volumeIndex(volume);
+    });
+    m_volumeArrayIndices[&array] = index;
+    return index;
+  }
+
+  /// Volumes are written after their dense and confined volumes
+  uint32_t addVolume(const TrackingVolume& volume) {
+    if (volume.hasBoundingVolumeHierarchy()) {
+      unsupported("bounding volume hierarchy in " + volume.volumeName());
+    }
+    VolumeRecord record;
+    std::vector<uint32_t> dense;
+    for (const auto& dVolume : volume.denseVolumes()) {
+      dense.push_back(addVolume(*dVolume));
+    }
+    record.denseVolumes = addIndices(dense);
+    if (auto confined = volume.confinedVolumes()) {
+      for (const auto& cVolume : confined->arrayObjects()) {
+        addVolume(*cVolume);
+      }
+      record.volumes = addVolumeArray(*confined);
+    }
+    if (auto layers = volume.confinedLayers()) {
+      for (const auto& layer : layers->arrayObjects()) {
+        addLayer(*layer);
+      }
+      record.layers = addArray(*layers, [this](const Layer& layer) {
+        return m_layerIndices.at(&layer);
+      });
+    }
+    record.geoID = volume.geoID().value();
+    const VolumeBounds& bounds = volume.volumeBounds();
+    record.boundsType = bounds.type();
+    if (bounds.type() == VolumeBounds::eCone or
+        bounds.type() == VolumeBounds::eOther) {
+      unsupported("bounds of volume " + volume.volumeName());
+    }
+    record.boundsValues = addDoubles(bounds.values());
+    record.name = addString(volume.volumeName());
+    record.material = addVolumeMaterial(volume.volumeMaterial());
+    record.transform = transformRecord(volume.transform());
+    m_volumes.push_back(record);
+    m_volumePtrs.push_back(&volume);
+    m_volumeIndices[&volume] = m_volumes.size() - 1;
+    return m_volumes.size() - 1;
+  }
+
+  uint32_t addBoundary(const BoundarySurfaceT<TrackingVolume>& boundary) {
+    auto search = m_boundaryIndices.find(&boundary);
+    if (search != m_boundaryIndices.end()) {
+      return search->second;
+    }
+    BoundaryRecord record;
+    record.surface = addSurface(boundary.surfaceRepresentation());
+    if (boundary.volumeInside() != nullptr) {
+      record.inside = volumeIndex(*boundary.volumeInside());
+    }
+    if (boundary.volumeOutside() != nullptr) {
+      record.outside = volumeIndex(*boundary.volumeOutside());
+    }
+    if (boundary.volumeArrayInside() != nullptr) {
+      record.insideArray = addVolumeArray(*boundary.volumeArrayInside());
+    }
+    if (boundary.volumeArrayOutside() != nullptr) {
+      record.outsideArray = addVolumeArray(*boundary.volumeArrayOutside());
+    }
+    m_boundaries.push_back(record);
+    m_boundaryIndices[&boundary] = m_boundaries.size() - 1;
+    return m_boundaries.size() - 1;
+  }
+
+  const GeometryContext& m_gctx;
+
+  std::vector<VolumeRecord> m_volumes;
+  std::vector<BoundaryRecord> m_boundaries;
+  std::vector<LayerRecord> m_layers;
+  std::vector<SurfaceRecord> m_surfaces;
+  std::vector<MaterialRecord> m_materials;
+  std::vector<BinUtilityRecord> m_binUtilities;
+  std::vector<BinningDataRecord> m_binningData;
+  std::vector<ArrayRecord> m_arrays;
+  std::vector<double> m_doubles;
+  std::vector<uint32_t> m_indices;
+  std::vector<char> m_chars;
+
+  std::vector<const TrackingVolume*> m_volumePtrs;
+  std::unordered_map<const TrackingVolume*, uint32_t> m_volumeIndices;
+  std::unordered_map<const TrackingVolumeArray*, uint32_t>
+      m_volumeArrayIndices;
+  std::unordered_map<const BoundarySurfaceT<TrackingVolume>*, uint32_t>
+      m_boundaryIndices;
+  std::unordered_map<const Layer*, uint32_t> m_layerIndices;
+  std::unordered_map<const Surface*, uint32_t> m_surfaceIndices;
+  std::unordered_map<const SurfaceBounds*, Range> m_boundsValues;
+  std::unordered_map<const ISurfaceMaterial*, uint32_t>
+      m_surfaceMaterialIndices;
+};
+
+/// Restores a tracking geometry from the records
+class SnapshotReader {
+ public:
+  SnapshotReader(
+      const GeometryContext& gctx, const char* data, size_t size,
+      const TrackingGeometrySnapshot::DetectorElementResolver& resolver)
+      : m_gctx(gctx), m_data(data), m_resolver(resolver) {
+    if (data == nullptr or size < sizeof(HeaderRecord)) {
+      corrupt("too small for the header");
+    }
+    std::memcpy(&m_header, data, sizeof(HeaderRecord));
+    if (std::memcmp(m_header.magic, s_magic, sizeof(s_magic)) != 0) {
+      corrupt("wrong magic");
+    }
+    if (m_header.version != s_version or
+        m_header.nSections != eNumSections) {
+      corrupt("unknown version " + std::to_string(m_header.version));
+    }
+    for (size_t is = 0; is < eNumSections; ++is) {
+      const SectionRecord& section = m_header.sections[is];
+      if (section.offset > size or
+          section.count > (size - section.offset) / s_entrySizes[is]) {
+        corrupt("section " + std::to_string(is) + " exceeds the buffer");
+      }
+    }
+    m_surfacePtrs.resize(count(eSurfaces));
+    m_surfaceMaterials.resize(count(eMaterials));
+    m_volumeMaterials.resize(count(eMaterials));
+  }
+
+  /// Restore the volume hierarchy, the world is the last volume
+  MutableTrackingVolumePtr restoreWorld() {
+    restoreMaterials();
+    size_t nVolumes = count(eVolumes);
+    if (nVolumes == 0) {
+      corrupt("no volumes");
+    }
+    for (size_t il = 0; il < count(eLayers); ++il) {
+      m_layerPtrs.push_back(restoreLayer(get<LayerRecord>(eLayers, il)));
+    }
+    for (size_t iv = 0; iv < nVolumes; ++iv) {
+      m_volumePtrs.push_back(restoreVolume(get<VolumeRecord>(eVolumes, iv)));
+    }
+    // replace the boundaries created by the volumes
+    std::vector<std::shared_ptr<const BoundarySurfaceT<TrackingVolume>>>
+        boundaries;
+    for (size_t ib = 0; ib < count(eBoundaries); ++ib) {
+      boundaries.push_back(
+          restoreBoundary(get<BoundaryRecord>(eBoundaries, ib)));
+    }
+    for (size_t iv = 0; iv < nVolumes; ++iv) {
+      auto bIndices = indices(get<VolumeRecord>(eVolumes, iv).boundaries);
+      if (bIndices.size() != m_volumePtrs[iv]->boundarySurfaces().size()) {
+        corrupt("boundaries do not match the volume bounds");
+      }
+      for (size_t face = 0; face < bIndices.size(); ++face) {
+        m_volumePtrs[iv]->updateBoundarySurface(
+            static_cast<BoundarySurfaceFace>(face),
+            boundaries.at(bIndices[face]), false);
+      }
+    }
+    return m_volumePtrs.back();
+  }
+
+  /// Check the GeometryIDs assigned during the closure
+  void checkGeometryIDs() const {
+    auto check = [](uint64_t stored, const GeometryID& restored,
+                    const std::string& what) {
+      if (stored != restored.value()) {
+        throw std::logic_error(
+            "Acts::TrackingGeometrySnapshot::read: GeometryID mismatch "
+            "for " +
+            what);
+      }
+    };
+    for (size_t iv = 0; iv < m_volumePtrs.size(); ++iv) {
+      check(get<VolumeRecord>(eVolumes, iv).geoID, m_volumePtrs[iv]->geoID(),
+            m_volumePtrs[iv]->volumeName());
+    }
+    for (size_t il = 0; il < m_layerPtrs.size(); ++il) {
+      const auto& record = get<LayerRecord>(eLayers, il);
+      check(record.geoID, m_layerPtrs[il]->geoID(), "layer");
+      check(get<SurfaceRecord>(eSurfaces, record.representation).geoID,
+            m_layerPtrs[il]->surfaceRepresentation().geoID(),
+            "layer representation");
+    }
+    for (size_t is = 0; is < m_surfacePtrs.size(); ++is) {
+      if (m_surfacePtrs[is] != nullptr) {
+        check(get<SurfaceRecord>(eSurfaces, is).geoID,
+              m_surfacePtrs[is]->geoID(), "surface");
+      }
+    }
+  }
+
+  size_t nVolumes() const { return m_volumePtrs.size(); }
+  size_t nLayers() const { return m_layerPtrs.size(); }
+
+ private:
+  size_t count(Section section) const {
+    return m_header.sections[section].count;
+  }
+
+  template <typename record_t>
+  record_t get(Section section, size_t index) const {
+    if (index >= count(section)) {
+      corrupt("index out of range in section " + std::to_string(section));
+    }
+    record_t record;
+    std::memcpy(&record,
+                m_data + m_header.sections[section].offset +
+                    index * sizeof(record_t),
+                sizeof(record_t));
+    return record;
+  }
+
+  template <typename value_t>
+  std::vector<value_t> pool(Section section, const Range& range) const {
+    if (range.offset > count(section) or
+        range.size > count(section) - range.offset) {
+      corrupt("range out of bounds in section " + std::to_string(section));
+    }
+    std::vector<value_t> values(range.size);
+    if (range.size > 0) {
+      std::memcpy(values.data(),
+                  m_data + m_header.sections[section].offset +
+                      range.offset * sizeof(value_t),
+                  range.size * sizeof(value_t));
+    }
+    return values;
+  }
+
+  std::vector<double> doubles(const Range& range) const {
+    return pool<double>(eDoubles, range);
+  }
+
+  std::vector<uint32_t> indices(const Range& range) const {
+    return pool<uint32_t>(eIndices, range);
+  }
+
+  template <typename bounds_t, typename values_t>
+  static std::array<double, bounds_t::eSize> boundsArray(
+      const values_t& values) {
+    std::array<double, bounds_t::eSize> array;
+    if (values.size() != array.size()) {
+      corrupt("wrong number of bound values");
+    }
+    std::copy(values.begin(), values.end(), array.begin());
+    return array;
+  }
+
+  static MaterialProperties restoreProperties(const double* values) {
+    ActsVectorF<5> numbers;
+    for (size_t in = 0; in < 5; ++in) {
+      numbers[in] = values[in];
+    }
+    return MaterialProperties(Material(numbers), values[5]);
+  }
+
+  BinUtility restoreBinUtility(uint32_t index) const {
+    const auto record = get<BinUtilityRecord>(eBinUtilities, index);
+    std::vector<BinningData> binningData;
+    for (size_t ib = 0; ib < record.binningData.size; ++ib) {
+      const auto bd =
+          get<BinningDataRecord>(eBinningData, record.binningData.offset + ib);
+      auto value = static_cast<BinningValue>(bd.value);
+      auto option = static_cast<BinningOption>(bd.option);
+      if (bd.zdim) {
+        binningData.emplace_back(value, bd.min, bd.max);
+      } else if (bd.type == arbitrary) {
+        auto boundaries = doubles(bd.boundaries);
+        binningData.emplace_back(
+            option, value,
+            std::vector<float>(boundaries.begin(), boundaries.end()));
+      } else {
+        binningData.emplace_back(option, value, bd.bins, bd.min, bd.max);
+      }
+    }
+    if (binningData.empty()) {
+      corrupt("bin utility without binning data");
+    }
+    // the transform is attached to the first binning data
+    BinUtility binUtility(
+        binningData.front(),
+        record.hasTransform ? restoreTransform(record.transform) : nullptr);
+    for (size_t ib = 1; ib < binningData.size(); ++ib) {
+      binUtility += BinUtility(binningData[ib]);
+    }
+    return binUtility;
+  }
+
+  void restoreMaterials() {
+    for (size_t im = 0; im < count(eMaterials); ++im) {
+      const auto record = get<MaterialRecord>(eMaterials, im);
+      auto values = doubles(record.values);
+      switch (record.type) {
+        case eHomogeneousSurface: {
+          if (values.size() != s_propertiesSize) {
+            corrupt("wrong size of homogeneous material");
+          }
+          m_surfaceMaterials[im] =
+              std::make_shared<const HomogeneousSurfaceMaterial>(
+                  restoreProperties(values.data()), record.splitFactor);
+          break;
+        }
+        case eBinnedSurface: {
+          if (values.size() !=
+              s_propertiesSize * record.bins0 * record.bins1) {
+            corrupt("wrong size of binned material");
+          }
+          MaterialPropertiesMatrix matrix(
+              record.bins1, MaterialPropertiesVector(record.bins0));
+          for (size_t i1 = 0; i1 < record.bins1; ++i1) {
+            for (size_t i0 = 0; i0 < record.bins0; ++i0) {
+              matrix[i1][i0] = restoreProperties(
+                  values.data() +
+                  s_propertiesSize * (i1 * record.bins0 + i0));
+            }
+          }
+          m_surfaceMaterials[im] =
+              std::make_shared<const BinnedSurfaceMaterial>(
+                  restoreBinUtility(record.binUtility), std::move(matrix),
+                  record.splitFactor);
+          break;
+        }
+        case eProtoSurface: {
+          m_surfaceMaterials[im] = std::make_shared<const ProtoSurfaceMaterial>(
+              restoreBinUtility(record.binUtility));
+          break;
+        }
+        case eHomogeneousVolume: {
+          if (values.size() != 5) {
+            corrupt("wrong size of volume material");
+          }
+          ActsVectorF<5> numbers;
+          for (size_t in = 0; in < 5; ++in) {
+            numbers[in] = values[in];
+          }
+          m_volumeMaterials[im] =
+              std::make_shared<const HomogeneousVolumeMaterial>(
+                  Material(numbers));
+          break;
+        }
+        default:
+          corrupt("unknown material type");
+      }
+    }
+  }
+
+  std::shared_ptr<const ISurfaceMaterial> surfaceMaterial(
+      uint32_t index) const {
+    if (index == s_none) {
+      return nullptr;
+    }
+    if (index >= m_surfaceMaterials.size() or
+        m_surfaceMaterials[index] == nullptr) {
+      corrupt("invalid surface material reference");
+    }
+    return m_surfaceMaterials[index];
+  }
+
+  /// Bounds are cached by their values, as they are written once
+  std::shared_ptr<const SurfaceBounds> restoreBounds(
+      const SurfaceRecord& record) {
+    if (record.boundsType == SurfaceBounds::eBoundless) {
+      return nullptr;
+    }
+    uint64_t key = (uint64_t(record.boundsValues.offset) << 8) +
+                   uint64_t(record.boundsType & 0xff);
+    auto search = m_bounds.find(key);
+    if (search != m_bounds.end()) {
+      return search->second;
+    }
+    auto values = doubles(record.boundsValues);
+    std::shared_ptr<const SurfaceBounds> bounds = nullptr;
+    switch (record.boundsType) {
+      case SurfaceBounds::eCone:
+        bounds = std::make_shared<const ConeBounds>(
+            boundsArray<ConeBounds>(values));
+        break;
+      case SurfaceBounds::eCylinder:
+        bounds = std::make_shared<const CylinderBounds>(
+            boundsArray<CylinderBounds>(values));
+        break;
+      case SurfaceBounds::eDiamond:
+        bounds = std::make_shared<const DiamondBounds>(
+            boundsArray<DiamondBounds>(values));
+        break;
+      case SurfaceBounds::eDisc:
+        bounds = std::make_shared<const RadialBounds>(
+            boundsArray<RadialBounds>(values));
+        break;
+      case SurfaceBounds::eEllipse:
+        bounds = std::make_shared<const EllipseBounds>(
+            boundsArray<EllipseBounds>(values));
+        break;
+      case SurfaceBounds::eLine:
+        bounds = std::make_shared<const LineBounds>(
+            boundsArray<LineBounds>(values));
+        break;
+      case SurfaceBounds::eRectangle:
+        bounds = std::make_shared<const RectangleBounds>(
+            boundsArray<RectangleBounds>(values));
+        break;
+      case SurfaceBounds::eTrapezoid:
+        bounds = std::make_shared<const TrapezoidBounds>(
+            boundsArray<TrapezoidBounds>(values));
+        break;
+      case SurfaceBounds::eDiscTrapezoid:
+        bounds = std::make_shared<const DiscTrapezoidBounds>(
+            boundsArray<DiscTrapezoidBounds>(values));
+        break;
+      case SurfaceBounds::eAnnulus:
+        bounds = std::make_shared<const AnnulusBounds>(
+            boundsArray<AnnulusBounds>(values));
+        break;
+      case SurfaceBounds::eConvexPolygon: {
+        if (values.size() % 2 != 0) {
+          corrupt("odd number of polygon values");
+        }
+        std::vector<Vector2D> vertices;
+        for (size_t iv = 0; iv < values.size(); iv += 2) {
+          vertices.emplace_back(values[iv], values[iv + 1]);
+        }
+        bounds =
+            std::make_shared<const ConvexPolygonBounds<PolygonDynamic>>(
+                vertices);
+        break;
+      }
+      default:
+        corrupt("unknown bounds type " + std::to_string(record.boundsType));
+    }
+    m_bounds[key] = bounds;
+    return bounds;
+  }
+
+  template <typename bounds_t>
+  std::shared_ptr<const bounds_t> typedBounds(const SurfaceRecord& record) {
+    auto bounds = restoreBounds(record);
+    auto typed = std::dynamic_pointer_cast<const bounds_t>(bounds);
+    if (bounds != nullptr and typed == nullptr) {
+      corrupt("bounds do not match the surface type");
+    }
+    return typed;
+  }
+
+  /// Surfaces are restored on first use
+  std::shared_ptr<const Surface> surface(uint32_t index) {
+    if (index >= m_surfacePtrs.size()) {
+      corrupt("invalid surface reference");
+    }
+    if (m_surfacePtrs[index] != nullptr) {
+      return m_surfacePtrs[index];
+    }
+    const auto record = get<SurfaceRecord>(eSurfaces, index);
+    std::shared_ptr<Surface> restored = nullptr;
+    if (record.detectorElement and m_resolver) {
+      const DetectorElementBase* element = m_resolver(GeometryID(record.geoID));
+      if (element != nullptr) {
+        restored =
+            std::const_pointer_cast<Surface>(element->surface().getSharedPtr());
+      }
+    }
+    if (restored == nullptr) {
+      auto transform = restoreTransform(record.transform);
+      switch (record.type) {
+        case Surface::Cone:
+          restored = Surface::makeShared<ConeSurface>(
+              transform, typedBounds<ConeBounds>(record));
+          break;
+        case Surface::Cylinder:
+          restored = Surface::makeShared<CylinderSurface>(
+              transform, typedBounds<CylinderBounds>(record));
+          break;
+        case Surface::Disc:
+          restored = Surface::makeShared<DiscSurface>(
+              transform, typedBounds<DiscBounds>(record));
+          break;
+        case Surface::Perigee:
+          restored = Surface::makeShared<PerigeeSurface>(transform);
+          break;
+        case Surface::Plane:
+        case Surface::Curvilinear:
+          restored = Surface::makeShared<PlaneSurface>(
+              transform, typedBounds<PlanarBounds>(record));
+          break;
+        case Surface::Straw:
+          restored = Surface::makeShared<StrawSurface>(
+              transform, typedBounds<LineBounds>(record));
+          break;
+        default:
+          corrupt("unknown surface type " + std::to_string(record.type));
+      }
+    }
+    if (record.material != s_none) {
+      restored->assignSurfaceMaterial(surfaceMaterial(record.material));
+    }
+    m_surfacePtrs[index] = restored;
+    return restored;
+  }
+
+  SurfaceArrayCreator::ProtoAxis protoAxis(const AxisRecord& record,
+                                           BinningValue bValue) const {
+    SurfaceArrayCreator::ProtoAxis pAxis;
+    pAxis.bType = record.equidistant ? equidistant : arbitrary;
+    pAxis.bValue = bValue;
+    pAxis.nBins = record.nBins;
+    pAxis.min = record.min;
+    pAxis.max = record.max;
+    if (not record.equidistant) {
+      pAxis.binEdges = doubles(record.edges);
+    }
+    return pAxis;
+  }
+
+  std::unique_ptr<SurfaceArray> restoreSurfaceArray(
+      const LayerRecord& record, const SurfaceRecord& representation) {
+    if (record.dimensions == s_none) {
+      return nullptr;
+    }
+    std::vector<std::shared_ptr<const Surface>> sensitive;
+    for (uint32_t is : indices(record.sensitive)) {
+      sensitive.push_back(surface(is));
+    }
+    if (record.dimensions == 0) {
+      if (sensitive.size() != 1) {
+        corrupt("single element surface array");
+      }
+      return std::make_unique<SurfaceArray>(sensitive.front());
+    }
+    if (record.dimensions != 2) {
+      corrupt("surface array dimension");
+    }
+    BinningValue bValueA = binX;
+    BinningValue bValueB = binY;
+    double layerValue = 0.;
+    auto transform = restoreTransform(representation.transform);
+    if (representation.type == Surface::Cylinder) {
+      bValueA = binPhi;
+      bValueB = binZ;
+      layerValue = doubles(representation.boundsValues)
+                       .at(CylinderBounds::eR);
+    } else if (representation.type == Surface::Disc) {
+      bValueA = binR;
+      bValueB = binPhi;
+      layerValue = transform->translation().z();
+    }
+    auto offsets = indices(record.binOffsets);
+    auto content = indices(record.binContent);
+    if (offsets.empty() or offsets.back() != content.size()) {
+      corrupt("surface array bin content");
+    }
+    std::vector<std::vector<size_t>> binContent;
+    for (size_t bin = 0; bin + 1 < offsets.size(); ++bin) {
+      if (offsets[bin] > offsets[bin + 1]) {
+        corrupt("surface array bin offsets");
+      }
+      binContent.emplace_back(content.begin() + offsets[bin],
+                              content.begin() + offsets[bin + 1]);
+    }
+    SurfaceArrayCreator sac(
+        getDefaultLogger("SurfaceArrayCreator", Logging::INFO));
+    return sac.surfaceArrayOnGrid(
+        m_gctx, std::move(sensitive), protoAxis(record.axes[0], bValueA),
+        protoAxis(record.axes[1], bValueB), binContent, layerValue,
+        restoreTransform(record.arrayTransform));
+  }
+
+  LayerPtr restoreLayer(const LayerRecord& record) {
+    const auto representation =
+        get<SurfaceRecord>(eSurfaces, record.representation);
+    if (record.navigation) {
+      return NavigationLayer::create(surface(record.representation),
+                                     record.thickness);
+    }
+    std::unique_ptr<ApproachDescriptor> ad = nullptr;
+    if (record.approach.size > 0) {
+      std::vector<std::shared_ptr<const Surface>> aSurfaces;
+      for (uint32_t is : indices(record.approach)) {
+        aSurfaces.push_back(surface(is));
+      }
+      ad = std::make_unique<GenericApproachDescriptor>(std::move(aSurfaces));
+    }
+    auto surfaceArray = restoreSurfaceArray(record, representation);
+    auto transform = restoreTransform(representation.transform);
+    auto layerType = static_cast<LayerType>(record.layerType);
+    MutableLayerPtr layer = nullptr;
+    switch (representation.type) {
+      case Surface::Cylinder:
+        layer = CylinderLayer::create(
+            transform, typedBounds<CylinderBounds>(representation),
+            std::move(surfaceArray), record.thickness, std::move(ad),
+            layerType);
+        break;
+      case Surface::Disc:
+        layer = DiscLayer::create(transform,
+                                  typedBounds<DiscBounds>(representation),
+                                  std::move(surfaceArray), record.thickness,
+                                  std::move(ad), layerType);
+        break;
+      case Surface::Plane:
+        layer = PlaneLayer::create(transform,
+                                   typedBounds<PlanarBounds>(representation),
+                                   std::move(surfaceArray), record.thickness,
+                                   std::move(ad), layerType);
+        break;
+      case Surface::Cone:
+        layer = ConeLayer::create(transform,
+                                  typedBounds<ConeBounds>(representation),
+                                  std::move(surfaceArray), record.thickness,
+                                  std::move(ad), layerType);
+        break;
+      default:
+        corrupt("unknown layer type");
+    }
+    if (representation.material != s_none) {
+      layer->surfaceRepresentation().assignSurfaceMaterial(
+          surfaceMaterial(representation.material));
+    }
+    return layer;
+  }
+
+  std::shared_ptr<const VolumeBounds> restoreVolumeBounds(
+      const VolumeRecord& record) const {
+    auto values = doubles(record.boundsValues);
+    switch (record.boundsType) {
+      case VolumeBounds::eCuboid:
+        return std::make_shared<const CuboidVolumeBounds>(
+            boundsArray<CuboidVolumeBounds>(values));
+      case VolumeBounds::eCutoutCylinder:
+        return std::make_shared<const CutoutCylinderVolumeBounds>(
+            boundsArray<CutoutCylinderVolumeBounds>(values));
+      case VolumeBounds::eCylinder:
+        return std::make_shared<const CylinderVolumeBounds>(
+            boundsArray<CylinderVolumeBounds>(values));
+      case VolumeBounds::eGenericCuboid:
+        return std::make_shared<const GenericCuboidVolumeBounds>(
+            boundsArray<GenericCuboidVolumeBounds>(values));
+      case VolumeBounds::eTrapezoid:
+        return std::make_shared<const TrapezoidVolumeBounds>(
+            boundsArray<TrapezoidVolumeBounds>(values));
+      default:
+        corrupt("unknown volume bounds type " +
+                std::to_string(record.boundsType));
+    }
+  }
+
+  template <typename object_t, typename object_f>
+  std::unique_ptr<const BinnedArray<object_t>> restoreArray(
+      uint32_t index, object_f object) const {
+    const auto record = get<ArrayRecord>(eArrays, index);
+    std::vector<object_t> objects;
+    for (uint32_t io : indices(record.objects)) {
+      objects.push_back(object(io));
+    }
+    if (record.binUtility == s_none) {
+      if (objects.size() != 1) {
+        corrupt("binned array without bin utility");
+      }
+      return std::make_unique<const BinnedArrayXD<object_t>>(objects.front());
+    }
+    auto flat = indices(record.grid);
+    if (flat.size() !=
+        size_t(record.bins[0]) * record.bins[1] * record.bins[2]) {
+      corrupt("binned array grid size");
+    }
+    std::vector<std::vector<std::vector<object_t>>> grid(
+        record.bins[2],
+        std::vector<std::vector<object_t>>(
+            record.bins[1], std::vector<object_t>(record.bins[0], nullptr)));
+    auto entry = flat.begin();
+    for (auto& g1 : grid) {
+      for (auto& g0 : g1) {
+        for (auto& gobject : g0) {
+          if (*entry != s_none) {
+            gobject = object(*entry);
+          }
+          ++entry;
+        }
+      }
+    }
+    return std::make_unique<const BinnedArrayXD<object_t>>(
+        grid, std::move(objects),
+        std::make_unique<const BinUtility>(
+            restoreBinUtility(record.binUtility)));
+  }
+
+  std::shared_ptr<const TrackingVolumeArray> volumeArray(uint32_t index) {
+    if (index == s_none) {
+      return nullptr;
+    }
+    auto search = m_volumeArrays.find(index);
+    if (search != m_volumeArrays.end()) {
+      return search->second;
+    }
+    std::shared_ptr<const TrackingVolumeArray> array =
+        restoreArray<TrackingVolumePtr>(index, [this](uint32_t iv) {
+          return TrackingVolumePtr(volume(iv));
+        });
+    m_volumeArrays[index] = array;
+    return array;
+  }
+
+  /// Access to the restored volumes, these are restored in order
+  MutableTrackingVolumePtr volume(uint32_t index) const {
+    if (index >= m_volumePtrs.size()) {
+      corrupt("invalid volume reference");
+    }
+    return m_volumePtrs[index];
+  }
+
+  MutableTrackingVolumePtr restoreVolume(const VolumeRecord& record) {
+    MutableTrackingVolumeVector dense;
+    for (uint32_t iv : indices(record.denseVolumes)) {
+      dense.push_back(volume(iv));
+    }
+    std::unique_ptr<const LayerArray> layers = nullptr;
+    if (record.layers != s_none) {
+      layers = restoreArray<LayerPtr>(record.layers, [this](uint32_t il) {
+        if (il >= m_layerPtrs.size()) {
+          corrupt("invalid layer reference");
+        }
+        return m_layerPtrs[il];
+      });
+    }
+    std::shared_ptr<const IVolumeMaterial> material = nullptr;
+    if (record.material != s_none) {
+      if (record.material >= m_volumeMaterials.size() or
+          m_volumeMaterials[record.material] == nullptr) {
+        corrupt("invalid volume material reference");
+      }
+      material = m_volumeMaterials[record.material];
+    }
+    auto name = pool<char>(eChars, record.name);
+    return TrackingVolume::create(
+        restoreTransform(record.transform), restoreVolumeBounds(record),
+        std::move(material), std::move(layers), volumeArray(record.volumes),
+        std::move(dense), std::string(name.begin(), name.end()));
+  }
+
+  std::shared_ptr<const BoundarySurfaceT<TrackingVolume>> restoreBoundary(
+      const BoundaryRecord& record) {
+    const TrackingVolume* inside =
+        record.inside != s_none ? volume(record.inside).get() : nullptr;
+    const TrackingVolume* outside =
+        record.outside != s_none ? volume(record.outside).get() : nullptr;
+    auto boundary = std::make_shared<BoundarySurfaceT<TrackingVolume>>(
+        surface(record.surface), inside, outside);
+    if (record.insideArray != s_none) {
+      boundary->attachVolumeArray(volumeArray(record.insideArray),
+                                  insideVolume);
+    }
+    if (record.outsideArray != s_none) {
+      boundary->attachVolumeArray(volumeArray(record.outsideArray),
+                                  outsideVolume);
+    }
+    return boundary;
+  }
+
+  const GeometryContext& m_gctx;
+  const char* m_data;
+  const TrackingGeometrySnapshot::DetectorElementResolver& m_resolver;
+  HeaderRecord m_header;
+
+  std::vector<std::shared_ptr<const ISurfaceMaterial>> m_surfaceMaterials;
+  std::vector<std::shared_ptr<const IVolumeMaterial>> m_volumeMaterials;
+  std::unordered_map<uint64_t, std::shared_ptr<const SurfaceBounds>> m_bounds;
+  std::vector<std::shared_ptr<const Surface>> m_surfacePtrs;
+  std::vector<LayerPtr> m_layerPtrs;
+  std::vector<MutableTrackingVolumePtr> m_volumePtrs;
+  std::unordered_map<uint32_t, std::shared_ptr<const TrackingVolumeArray>>
+      m_volumeArrays;
+};
+
+}  // namespace
+
+Acts::TrackingGeometrySnapshot::TrackingGeometrySnapshot(
+    const Config& cfg, std::unique_ptr<const Logger> logger)
+    : m_cfg(cfg), m_logger(std::move(logger)) {}
+
+std::vector<char> Acts::TrackingGeometrySnapshot::write(
+    const GeometryContext& gctx, const TrackingGeometry& tGeometry) const {
+  SnapshotWriter writer(gctx);
+  writer.addWorld(*tGeometry.highestTrackingVolume());
+  auto buffer = writer.serialize();
+  ACTS_DEBUG("Wrote snapshot of " << buffer.size() << " bytes with "
+                                  << writer.nVolumes() << " volumes, "
+                                  << writer.nLayers() << " layers and "
+                                  << writer.nSurfaces() << " surfaces.");
+  return buffer;
+}
+
+void Acts::TrackingGeometrySnapshot::writeFile(
+    const GeometryContext& gctx, const TrackingGeometry& tGeometry,
+    const std::string& fileName) const {
+  auto buffer = write(gctx, tGeometry);
+  std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+  file.write(buffer.data(), buffer.size());
+  if (not file) {
+    throw std::runtime_error(
+        "Acts::TrackingGeometrySnapshot::writeFile: could not write " +
+        fileName);
+  }
+}
+
+std::unique_ptr<const Acts::TrackingGeometry>
+Acts::TrackingGeometrySnapshot::read(const GeometryContext& gctx,
+                                     const char* data, size_t size) const {
+  SnapshotReader reader(gctx, data, size, m_cfg.detectorElementResolver);
+  auto world = reader.restoreWorld();
+  // the closure assigns the GeometryIDs again
+  auto tGeometry = std::make_unique<const TrackingGeometry>(world);
+  reader.checkGeometryIDs();
+  ACTS_DEBUG("Restored " << reader.nVolumes() << " volumes and "
+                         << reader.nLayers() << " layers from snapshot.");
+  return tGeometry;
+}
+
+std::unique_ptr<const Acts::TrackingGeometry>
+Acts::TrackingGeometrySnapshot::readFile(const GeometryContext& gctx,
+                                         const std::string& fileName) const {
+  std::ifstream file(fileName, std::ios::binary);
+  if (not file) {
+    throw std::runtime_error(
+        "Acts::TrackingGeometrySnapshot::readFile: could not open " +
+        fileName);
+  }
+  std::vector<char> buffer((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+  return read(gctx, buffer.data(), buffer.size());
+}
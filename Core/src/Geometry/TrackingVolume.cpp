@@ -72,7 +72,8 @@ Acts::TrackingVolume::TrackingVolume(
       m_volumeMaterial(std::move(volumeMaterial)),
       m_name(volumeName),
       m_descendantVolumes(std::move(descendants)),
-      m_bvhTop(top) {
+      m_bvhTop(top),
+      m_bvhFlat(top) {
   createBoundarySurfaces();
   // we take a copy of the unique box pointers, but we want to
   // store them as consts.
@@ -0,0 +1,183 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
+#include "Acts/Geometry/GeometryCache.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+Acts::PlaneSurfaceBatch::PlaneSurfaceBatch(
+    const std::vector<const Surface*>& surfaces) {
+  for (const auto& surface : surfaces) {
+    if (surface != nullptr and canBatch(*surface)) {
+      m_surfaces.push_back(surface);
+    }
+  }
+  // sort & unique for the binary search lookup
+  std::sort(m_surfaces.begin(), m_surfaces.end());
+  m_surfaces.erase(std::unique(m_surfaces.begin(), m_surfaces.end()),
+                   m_surfaces.end());
+
+  const size_t nSurfaces = m_surfaces.size();
+  m_contextual.reserve(nSurfaces);
+  m_placements.resize(nSurfaces);
+  for (auto* column : {&m_x0, &m_y0, &m_hx, &m_hy, &m_slope}) {
+    column->reserve(nSurfaces);
+  }
+
+  for (size_t is = 0; is < nSurfaces; ++is) {
+    const Surface* surface = m_surfaces[is];
+    // detector element placements are looked up when intersecting
+    const bool contextual = (surface->associatedDetectorElement() != nullptr);
+    m_contextual.push_back(contextual);
+    if (not contextual) {
+      m_placements.set(is, surface->transform(GeometryContext()));
+    }
+
+    const SurfaceBounds& bounds = surface->bounds();
+    if (bounds.type() == SurfaceBounds::eRectangle) {
+      const auto& rBounds = static_cast<const RectangleBounds&>(bounds);
+      m_x0.push_back(0.5 * (rBounds.min().x() + rBounds.max().x()));
+      m_y0.push_back(0.5 * (rBounds.min().y() + rBounds.max().y()));
+      m_hx.push_back(rBounds.halfLengthX());
+      m_hy.push_back(rBounds.halfLengthY());
+      m_slope.push_back(0.);
+    } else {
+      const auto& tBounds = static_cast<const TrapezoidBounds&>(bounds);
+      double hxNeg = tBounds.get(TrapezoidBounds::eHalfLengthXnegY);
+      double hxPos = tBounds.get(TrapezoidBounds::eHalfLengthXposY);
+      double hy = tBounds.get(TrapezoidBounds::eHalfLengthY);
+      m_x0.push_back(0.);
+      m_y0.push_back(0.);
+      m_hx.push_back(0.5 * (hxNeg + hxPos));
+      m_hy.push_back(hy);
+      m_slope.push_back(0.5 * (hxPos - hxNeg) / hy);
+      m_hasTrapezoids = true;
+    }
+  }
+}
+
+bool Acts::PlaneSurfaceBatch::canBatch(const Surface& surface) {
+  if (surface.type() != Surface::Plane) {
+    return false;
+  }
+  auto bType = surface.bounds().type();
+  return (bType == SurfaceBounds::eRectangle or
+          bType == SurfaceBounds::eTrapezoid);
+}
+
+bool Acts::PlaneSurfaceBatch::supports(const BoundaryCheck& bcheck) const {
+  switch (bcheck.type()) {
+    case BoundaryCheck::Type::eNone:
+      return true;
+    case BoundaryCheck::Type::eAbsolute:
+      // the tolerance around a polygon is not a simple envelope
+      return (not m_hasTrapezoids or bcheck.tolerance() == Vector2D(0., 0.));
+    default:
+      return false;
+  }
+}
+
+size_t Acts::PlaneSurfaceBatch::slot(const Surface* surface) const {
+  auto it = std::lower_bound(m_surfaces.begin(), m_surfaces.end(), surface);
+  if (it == m_surfaces.end() or *it != surface) {
+    return npos;
+  }
+  return static_cast<size_t>(it - m_surfaces.begin());
+}
+
+void Acts::PlaneSurfaceBatch::intersect(
+    const GeometryContext& gctx, const Vector3D& position,
+    const Vector3D& direction, const BoundaryCheck& bcheck,
+    const std::vector<size_t>& slots, std::vector<Intersection>& intersections,
+    const GeometryCache* cache) const {
+  const size_t nSlots = slots.size();
+  const double px = position.x(), py = position.y(), pz = position.z();
+  const double dx = direction.x(), dy = direction.y(), dz = direction.z();
+  const bool checkBounds = (bcheck.type() != BoundaryCheck::Type::eNone);
+  const double tol0 = checkBounds ? bcheck.tolerance()[0] : 0.;
+  const double tol1 = checkBounds ? bcheck.tolerance()[1] : 0.;
+  const double tolerance2 = s_onSurfaceTolerance * s_onSurfaceTolerance;
+
+  // the cache is ordered by identifier, hence the sensitive surfaces of a
+  // layer are consecutive and the slot follows from the sensitive number
+  // once the offset is known; a guess is verified before it is used
+  int64_t slotOffset = 0;
+  auto cacheSlot = [&](const Surface& surface) -> uint32_t {
+    const int64_t sensitive = surface.geoID().sensitive();
+    const int64_t guess = sensitive + slotOffset;
+    if (guess >= 0 and guess < static_cast<int64_t>(cache->size()) and
+        cache->surface(guess) == &surface) {
+      return guess;
+    }
+    const uint32_t cslot = cache->slot(surface);
+    if (cslot != GeometryCache::npos) {
+      slotOffset = static_cast<int64_t>(cslot) - sensitive;
+    }
+    return cslot;
+  };
+
+  intersections.resize(nSlots);
+  for (size_t is = 0; is < nSlots; ++is) {
+    const size_t i = slots[is];
+    // static placements are read from the batch, contextual ones from the
+    // cache columns or, if not cached, from the contextual transform
+    const detail::TransformColumns* columns = &m_placements;
+    size_t ic = i;
+    const Transform3D* transform = nullptr;
+    if (m_contextual[i]) {
+      const uint32_t cslot = (cache != nullptr) ? cacheSlot(*m_surfaces[i])
+                                                : GeometryCache::npos;
+      if (cslot != GeometryCache::npos) {
+        columns = &cache->columns();
+        ic = cslot;
+      } else {
+        transform = &m_surfaces[i]->transform(gctx);
+      }
+    }
+    double cx, cy, cz, nx, ny, nz, ux, uy, uz, vx, vy, vz;
+    if (transform == nullptr) {
+      cx = columns->cx[ic], cy = columns->cy[ic], cz = columns->cz[ic];
+      nx = columns->nx[ic], ny = columns->ny[ic], nz = columns->nz[ic];
+      ux = columns->ux[ic], uy = columns->uy[ic], uz = columns->uz[ic];
+      vx = columns->vx[ic], vy = columns->vy[ic], vz = columns->vz[ic];
+    } else {
+      const auto& tMatrix = transform->matrix();
+      ux = tMatrix(0, 0), uy = tMatrix(1, 0), uz = tMatrix(2, 0);
+      vx = tMatrix(0, 1), vy = tMatrix(1, 1), vz = tMatrix(2, 1);
+      nx = tMatrix(0, 2), ny = tMatrix(1, 2), nz = tMatrix(2, 2);
+      cx = tMatrix(0, 3), cy = tMatrix(1, 3), cz = tMatrix(2, 3);
+    }
+    const double denom = dx * nx + dy * ny + dz * nz;
+    const double path =
+        (nx * (cx - px) + ny * (cy - py) + nz * (cz - pz)) / denom;
+    const Vector3D iposition(px + path * dx, py + path * dy, pz + path * dz);
+    // the local position relative to the bounds centre
+    const double rx = iposition.x() - cx;
+    const double ry = iposition.y() - cy;
+    const double rz = iposition.z() - cz;
+    const double lx = ux * rx + uy * ry + uz * rz - m_x0[i];
+    const double ly = vx * rx + vy * ry + vz * rz - m_y0[i];
+    const bool inside =
+        (not checkBounds) or
+        ((std::abs(ly) <= m_hy[i] + tol1) and
+         (std::abs(lx) <= m_hx[i] + m_slope[i] * ly + tol0));
+    if (denom == 0. or not inside) {
+      intersections[is] = Intersection();
+      continue;
+    }
+    Intersection::Status status = (path * path < tolerance2)
+                                      ? Intersection::Status::onSurface
+                                      : Intersection::Status::reachable;
+    intersections[is] = Intersection(iposition, path, status);
+  }
+}
@@ -20,12 +20,12 @@ Acts::SurfaceBounds::BoundsType Acts::TrapezoidBounds::type() const {
 
 bool Acts::TrapezoidBounds::inside(const Acts::Vector2D& lposition,
                                    const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, vertices());
+  return bcheck.isInside(lposition, m_edges);
 }
 
 double Acts::TrapezoidBounds::distanceToBoundary(
     const Acts::Vector2D& lposition) const {
-  return BoundaryCheck(true).distance(lposition, vertices());
+  return BoundaryCheck(true).distance(lposition, m_edges);
 }
 
 std::vector<Acts::Vector2D> Acts::TrapezoidBounds::vertices(
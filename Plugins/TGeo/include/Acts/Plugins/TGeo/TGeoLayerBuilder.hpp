@@ -108,6 +108,9 @@ class TGeoLayerBuilder : public ILayerBuilder {
     bool checkRingLayout = false;
     /// Tolerance for ring detection and association
     double ringTolerance = 0_mm;
+    /// Maximal number of layers created concurrently after parsing,
+    /// 1 creates them sequentially
+    size_t nThreads = 1;
   };
 
   /// Constructor
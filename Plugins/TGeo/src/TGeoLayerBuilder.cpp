@@ -83,9 +83,13 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
   // Screen output of the configuration
   ACTS_DEBUG(layerType << " layers : found " << layerConfigs.size()
                        << " configuration(s)" + addonOutput);
+  // The surfaces and configuration of the layers to be created
+  using LayerSurfaceVector = std::vector<std::shared_ptr<const Surface>>;
+  std::vector<std::pair<LayerSurfaceVector, LayerConfig>> layerInputs;
+
+  // Parsing the TGeo tree is sequential, the layers are created afterwards
   for (auto layerCfg : layerConfigs) {
     // Prepare the layer surfaces
-    using LayerSurfaceVector = std::vector<std::shared_ptr<const Surface>>;
     LayerSurfaceVector layerSurfaces;
 
     ACTS_DEBUG("- layer configuration found for layer "
@@ -103,31 +107,12 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
       ACTS_DEBUG(
           "- number of senstive sensors found : " << layerSurfaces.size());
 
-      // Helper function to fill the layer
-      auto fillLayer = [&](const LayerSurfaceVector lSurfaces,
-                           const LayerConfig& lCfg) -> void {
-        // Create the layer  - either way as cylinder or disk
-        if (type == 0) {
-          ProtoLayer pl(gctx, lSurfaces);
-          pl.envR = {lCfg.envelope.first, lCfg.envelope.second};
-          pl.envZ = {lCfg.envelope.second, lCfg.envelope.second};
-          layers.push_back(m_cfg.layerCreator->cylinderLayer(
-              gctx, lSurfaces, lCfg.binsLoc0, lCfg.binsLoc1, pl));
-        } else {
-          ProtoLayer pl(gctx, lSurfaces);
-          pl.envR = {lCfg.envelope.first, lCfg.envelope.second};
-          pl.envZ = {lCfg.envelope.second, lCfg.envelope.second};
-          layers.push_back(m_cfg.layerCreator->discLayer(
-              gctx, lSurfaces, lCfg.binsLoc0, lCfg.binsLoc1, pl));
-        }
-      };
-
       // There is no split to be attempted
       if (layerCfg.splitParametersR.empty() and
           layerCfg.splitParametersZ.empty()) {
-        // No splitting to be done, fill and return
-        fillLayer(layerSurfaces, layerCfg);
-        return;
+        // No splitting to be done, fill and stop parsing
+        layerInputs.emplace_back(layerSurfaces, layerCfg);
+        break;
       }
 
       std::vector<LayerSurfaceVector> splitLayerSurfaces = {layerSurfaces};
@@ -230,10 +215,28 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
       for (const auto& slSurfaces : splitLayerSurfaces) {
         ACTS_VERBOSE("  - layer " << il++ << " has " << slSurfaces.size()
                                   << " surfaces.");
-        fillLayer(slSurfaces, layerCfg);
+        layerInputs.emplace_back(slSurfaces, layerCfg);
       }
     }
   }
+
+  // Create the layer - either way as cylinder or disk
+  auto createLayer = [&](size_t il) -> MutableLayerPtr {
+    const auto& [lSurfaces, lCfg] = layerInputs[il];
+    ProtoLayer pl(gctx, lSurfaces);
+    pl.envR = {lCfg.envelope.first, lCfg.envelope.second};
+    pl.envZ = {lCfg.envelope.second, lCfg.envelope.second};
+    if (type == 0) {
+      return m_cfg.layerCreator->cylinderLayer(gctx, lSurfaces, lCfg.binsLoc0,
+                                               lCfg.binsLoc1, pl);
+    }
+    return m_cfg.layerCreator->discLayer(gctx, lSurfaces, lCfg.binsLoc0,
+                                         lCfg.binsLoc1, pl);
+  };
+  for (auto& layer : m_cfg.layerCreator->createLayers(
+           layerInputs.size(), createLayer, m_cfg.nThreads)) {
+    layers.push_back(std::move(layer));
+  }
 }
 
 void Acts::TGeoLayerBuilder::resolveSensitive(
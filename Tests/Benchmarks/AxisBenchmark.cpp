@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+
+using namespace Acts;
+using namespace Acts::detail;
+
+/// Compare the bin lookup of an equidistant axis with the previous one,
+/// which divided by the bin width and wrapped the integer bin index, as
+/// well as with the batch lookup.
+template <AxisBoundaryType bdt>
+void runAxisBenchmarks(const std::string& name,
+                       const std::vector<double>& values) {
+  Axis<AxisType::Equidistant, bdt> axis(-M_PI, M_PI, 120u);
+  std::cout << name << " axis:" << std::endl;
+
+  auto previous = [&](const double& x) {
+    return axis.wrapBin(std::floor((x - axis.getMin()) / axis.getBinWidth()) +
+                        1);
+  };
+  std::cout << "- previous getBin: "
+            << Acts::Test::microBenchmark(previous, values, 200) << std::endl;
+
+  auto single = [&](const double& x) { return axis.getBin(x); };
+  std::cout << "- getBin: "
+            << Acts::Test::microBenchmark(single, values, 200) << std::endl;
+
+  // one iteration is a batch of all values
+  std::vector<size_t> bins;
+  auto batch = [&]() {
+    axis.getBins(values, bins);
+    return bins.back();
+  };
+  auto batchResult = Acts::Test::microBenchmark(batch, 1, 200);
+  std::cout << "- getBins: " << batchResult.runTimeMedian().count() / 1000.
+            << "us per run, "
+            << batchResult.runTimeMedian().count() / values.size()
+            << "ns per value" << std::endl;
+}
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  // values covering the axis range and one period beyond on either side,
+  // like phi values before they are brought into [-pi, pi)
+  constexpr size_t nValues = 10'000;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-2 * M_PI, 2 * M_PI);
+  std::vector<double> values;
+  values.reserve(nValues);
+  for (size_t i = 0; i < nValues; ++i) {
+    values.push_back(uniform(rng));
+  }
+
+  runAxisBenchmarks<AxisBoundaryType::Open>("Open", values);
+  runAxisBenchmarks<AxisBoundaryType::Bound>("Bound", values);
+  runAxisBenchmarks<AxisBoundaryType::Closed>("Closed", values);
+
+  // local bins of a 3D field map grid
+  EquidistantAxis x(-1000., 1000., 100u);
+  EquidistantAxis y(-1000., 1000., 100u);
+  EquidistantAxis z(-3000., 3000., 300u);
+  Grid<double, EquidistantAxis, EquidistantAxis, EquidistantAxis> grid(
+      std::make_tuple(x, y, z));
+  std::vector<std::array<double, 3>> points;
+  points.reserve(nValues);
+  std::uniform_real_distribution<double> unit(-1.1, 1.1);
+  for (size_t i = 0; i < nValues; ++i) {
+    points.push_back({{1000. * unit(rng), 1000. * unit(rng),
+                       3000. * unit(rng)}});
+  }
+  auto localBins = [&](const std::array<double, 3>& pos) {
+    return grid.globalBinFromPosition(pos);
+  };
+  std::cout << "Grid:" << std::endl;
+  std::cout << "- globalBinFromPosition: "
+            << Acts::Test::microBenchmark(localBins, points, 200)
+            << std::endl;
+
+  return 0;
+}
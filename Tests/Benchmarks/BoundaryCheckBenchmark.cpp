@@ -14,6 +14,9 @@
 #include <vector>
 
 #include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -127,5 +130,54 @@ int main(int /*argc*/, char** /*argv[]*/) {
                   Mode::SlowOutside);
   run_all_benches(BoundaryCheck(cov, 3.0), "Cov. tolerance", Mode::SlowOutside);
 
+  // === BOUNDS BENCHMARKS ===
+
+  // The polygon bounds check against their precomputed edges, compare with
+  // the check against the vertices and with the batched check
+  const TrapezoidBounds trapezoid(0.2, 0.3, 0.25);
+  const DiamondBounds diamond(0.1, 0.3, 0.2, 0.25, 0.25);
+  const ConvexPolygonBounds<4> polygon4(
+      {{-0.1, -0.25}, {0.1, -0.25}, {0.3, 0.25}, {-0.3, 0.25}});
+  const ConvexPolygonBounds<PolygonDynamic> polygonDynamic(
+      std::vector<Vector2D>{{-0.1, -0.25}, {0.1, -0.25}, {0.3, 0.25}});
+
+  // Symmetric, positive definite covariance for the bounds checks
+  ActsSymMatrixD<2> bounds_cov;
+  bounds_cov << 0.01, 0.002, 0.002, 0.008;
+
+  // Random points around the bounds, which are centered at the origin
+  std::vector<Vector2D> bounds_points(NTESTS_SLOW);
+  std::generate(bounds_points.begin(), bounds_points.end(),
+                [&]() -> Vector2D { return random_point() - center; });
+
+  auto run_bounds_benches = [&](const auto& bounds,
+                                const std::string& bounds_name) {
+    const auto vertices = bounds.vertices();
+    const std::pair<BoundaryCheck, std::string> checks[] = {
+        {BoundaryCheck(true), "no tolerance"},
+        {BoundaryCheck(true, true, 0.6, 0.45), "abs. tolerance"},
+        {BoundaryCheck(bounds_cov, 3.0), "cov. tolerance"}};
+    for (const auto& [check, check_name] : checks) {
+      print_bench_header(bounds_name + ", " + check_name);
+      run_bench_with_inputs(
+          [&](const auto& point) { return check.isInside(point, vertices); },
+          bounds_points, "Vertices");
+      run_bench_with_inputs(
+          [&](const auto& point) { return bounds.inside(point, check); },
+          bounds_points, "Bounds");
+      std::vector<bool> inside;
+      run_bench(
+          [&] {
+            check.isInside(bounds_points, bounds.edges(), inside);
+            return inside.size();
+          },
+          1, "Batch of " + std::to_string(bounds_points.size()));
+    }
+  };
+  run_bounds_benches(trapezoid, "TrapezoidBounds");
+  run_bounds_benches(diamond, "DiamondBounds");
+  run_bounds_benches(polygon4, "ConvexPolygonBounds<4>");
+  run_bounds_benches(polygonDynamic, "ConvexPolygonBounds<PolygonDynamic>");
+
   return 0;
 }
@@ -0,0 +1,73 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <iostream>
+#include <string>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/GainMatrixUpdater.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+using namespace Acts;
+
+using SourceLink = MinimalSourceLink;
+
+/// Benchmark the Kalman update of a track state with the given measurement
+void runUpdateBenchmark(const std::string& name,
+                        const FittableMeasurement<SourceLink>& meas) {
+  BoundSymMatrix covariance = BoundSymMatrix::Identity();
+  covariance(eLOC_0, eLOC_1) = covariance(eLOC_1, eLOC_0) = 0.1;
+  covariance(eLOC_0, ePHI) = covariance(ePHI, eLOC_0) = 0.01;
+  BoundVector parameters;
+  parameters << 0.3, 0.5, 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+
+  MultiTrajectory<SourceLink> traj;
+  traj.addTrackState(TrackStatePropMask::All);
+  auto ts = traj.getTrackState(0);
+  ts.uncalibrated() = SourceLink{&meas};
+  std::visit([&](const auto& m) { ts.setCalibrated(m); }, meas);
+  ts.predicted() = parameters;
+  ts.predictedCovariance() = covariance;
+
+  GainMatrixUpdater<BoundParameters> updater;
+  GeometryContext gctx;
+  auto update = [&]() {
+    auto result = updater(gctx, ts);
+    return ts.chi2() + result.ok();
+  };
+  std::cout << name << ": " << Acts::Test::microBenchmark(update, 1000, 200)
+            << std::endl;
+}
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  auto plane = Surface::makeShared<PlaneSurface>(Vector3D(0., 0., 0.),
+                                                 Vector3D(0., 0., 1.));
+
+  ActsSymMatrixD<1> cov1;
+  cov1 << 0.01;
+  runUpdateBenchmark("1D measurement update",
+                     Measurement<SourceLink, eLOC_0>(plane, {}, cov1, 0.1));
+
+  ActsSymMatrixD<2> cov2;
+  cov2 << 0.01, 0.001, 0.001, 0.04;
+  runUpdateBenchmark(
+      "2D measurement update",
+      Measurement<SourceLink, eLOC_0, eLOC_1>(plane, {}, cov2, 0.1, 0.2));
+
+  ActsSymMatrixD<3> cov3;
+  cov3 << 0.01, 0.001, 0., 0.001, 0.04, 0., 0., 0., 0.001;
+  runUpdateBenchmark("3D measurement update",
+                     Measurement<SourceLink, eLOC_0, eLOC_1, eQOP>(
+                         plane, {}, cov3, 0.1, 0.2, 0.02));
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+
+using namespace Acts;
+using namespace Acts::detail;
+
+using Point = std::array<double, 3>;
+
+/// Fill a 3D field-map-like grid and benchmark the interpolation on a set
+/// of random points and on a set of points along straight lines, which is
+/// the typical access pattern of the propagation.
+template <typename grid_t>
+void runBenchmarks(const std::string& name, grid_t& grid,
+                   const std::vector<Point>& random,
+                   const std::vector<Point>& lines) {
+  auto nBins = grid.numLocalBins();
+  for (size_t i = 0; i <= nBins[0] + 1; ++i) {
+    for (size_t j = 0; j <= nBins[1] + 1; ++j) {
+      for (size_t k = 0; k <= nBins[2] + 1; ++k) {
+        grid.atLocalBins({{i, j, k}}) =
+            Vector3D(0.1 * i + 0.01 * j, 0.1 * j - 0.01 * k, 2. + 0.001 * k);
+      }
+    }
+  }
+
+  std::cout << name << ":" << std::endl;
+  auto interpolate = [&](const Point& pos) { return grid.interpolate(pos); };
+  std::cout << "- interpolate (random): "
+            << Acts::Test::microBenchmark(interpolate, random, 200)
+            << std::endl;
+  std::cout << "- interpolate (lines): "
+            << Acts::Test::microBenchmark(interpolate, lines, 200)
+            << std::endl;
+  auto neighborhood = [&](const Point& pos) {
+    double sum = 0.;
+    for (size_t bin : grid.neighborHoodIndices(
+             grid.localBinsFromPosition(pos), 1u)) {
+      sum += grid.at(bin).z();
+    }
+    return sum;
+  };
+  std::cout << "- neighborhood (random): "
+            << Acts::Test::microBenchmark(neighborhood, random, 200)
+            << std::endl;
+}
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  // A grid of 128^3 bins, large compared to the caches
+  constexpr size_t nBins = 128;
+  EquidistantAxis x(-1000., 1000., nBins);
+  EquidistantAxis y(-1000., 1000., nBins);
+  EquidistantAxis z(-3000., 3000., nBins);
+
+  // Random points inside the grid
+  constexpr size_t nPoints = 100'000;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-0.99, 0.99);
+  std::vector<Point> random;
+  random.reserve(nPoints);
+  for (size_t i = 0; i < nPoints; ++i) {
+    random.push_back({{1000. * uniform(rng), 1000. * uniform(rng),
+                       3000. * uniform(rng)}});
+  }
+
+  // Points along straight lines from the origin with a step of 5 mm
+  std::vector<Point> lines;
+  lines.reserve(nPoints);
+  while (lines.size() < nPoints) {
+    Vector3D dir(uniform(rng), uniform(rng), uniform(rng));
+    dir.normalize();
+    for (double s = 0.; s < 990. and lines.size() < nPoints; s += 5.) {
+      Vector3D pos = s * dir;
+      lines.push_back({{pos.x(), pos.y(), pos.z()}});
+    }
+  }
+
+  Grid<Vector3D, EquidistantAxis, EquidistantAxis, EquidistantAxis> grid(
+      std::make_tuple(x, y, z));
+  runBenchmarks("Vector3D field map", grid, random, lines);
+
+  return 0;
+}
@@ -12,14 +12,19 @@
 
 #include <cmath>
 
+#include "Acts/Geometry/AlignedDetectorElement.hpp"
+#include "Acts/Geometry/AlignmentStore.hpp"
+#include "Acts/Geometry/GeometryCache.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Units.hpp"
 
@@ -38,6 +43,7 @@ const bool testPlane = true;
 const bool testDisc = true;
 const bool testCylinder = true;
 const bool testStraw = true;
+const bool testPlaneBatch = true;
 
 // Create a test context
 GeometryContext tgContext = GeometryContext();
@@ -66,6 +72,78 @@ auto aCylinder = Surface::makeShared<CylinderSurface>(
 auto aStraw = Surface::makeShared<StrawSurface>(
     std::make_shared<Transform3D>(at), 50_cm, 2_m);
 
+// Define a set of candidate planes, as seen on a layer: 3 x 3 modules with
+// rectangle and trapezoid bounds around the plane position
+std::vector<Transform3D> makeCandidateTransforms() {
+  std::vector<Transform3D> transforms;
+  for (int ix = -1; ix <= 1; ++ix) {
+    for (int iy = -1; iy <= 1; ++iy) {
+      transforms.push_back(at * Translation3D(ix * 0.8_m, iy * 0.8_m,
+                                              (ix + iy) % 2 ? 2_cm : -2_cm));
+    }
+  }
+  return transforms;
+}
+auto candidateTransforms = makeCandidateTransforms();
+auto crb = std::make_shared<RectangleBounds>(0.4_m, 0.4_m);
+auto ctb = std::make_shared<TrapezoidBounds>(0.3_m, 0.5_m, 0.4_m);
+
+std::shared_ptr<const PlanarBounds> candidateBounds(size_t ic) {
+  if (ic % 3 == 1) {
+    return crb;
+  }
+  return ctb;
+}
+
+std::vector<std::shared_ptr<const Surface>> makeCandidatePlanes() {
+  std::vector<std::shared_ptr<const Surface>> planes;
+  for (size_t ic = 0; ic < candidateTransforms.size(); ++ic) {
+    planes.push_back(Surface::makeShared<PlaneSurface>(
+        std::make_shared<Transform3D>(candidateTransforms[ic]),
+        candidateBounds(ic)));
+  }
+  return planes;
+}
+auto candidatePlanes = makeCandidatePlanes();
+
+// The same candidates as aligned detector elements, the alignment context
+// moves them by 1 mm along their normal
+std::vector<std::unique_ptr<const AlignedDetectorElement>>
+makeCandidateElements() {
+  std::vector<std::unique_ptr<const AlignedDetectorElement>> elements;
+  for (size_t ic = 0; ic < candidateTransforms.size(); ++ic) {
+    elements.push_back(std::make_unique<const AlignedDetectorElement>(
+        std::make_shared<Transform3D>(candidateTransforms[ic]),
+        candidateBounds(ic), 0.1_mm));
+    const_cast<Surface&>(elements.back()->surface())
+        .assignGeoID(GeometryID().setVolume(1).setLayer(2).setSensitive(
+            ic + 1));
+  }
+  return elements;
+}
+auto candidateElements = makeCandidateElements();
+
+GeometryContext makeAlignedContext() {
+  std::vector<AlignmentStore::Entry> entries;
+  for (const auto& element : candidateElements) {
+    entries.emplace_back(element->surface().geoID(),
+                         element->nominalTransform() *
+                             Translation3D(0., 0., 1_mm));
+  }
+  return AlignmentContext{
+      std::make_shared<const AlignmentStore>(std::move(entries))};
+}
+GeometryContext alignedContext = makeAlignedContext();
+
+std::vector<const Surface*> candidateElementSurfaces() {
+  std::vector<const Surface*> surfaces;
+  for (const auto& element : candidateElements) {
+    surfaces.push_back(&element->surface());
+  }
+  return surfaces;
+}
+GeometryCache alignedCache(alignedContext, candidateElementSurfaces());
+
 // The orgin of our attempts for plane, disc and cylinder
 Vector3D origin(0., 0., 0.);
 
@@ -90,6 +168,48 @@ MicroBenchmarkResult intersectionTest(const surface_t& surface, double phi,
       nrepts);
 }
 
+/// Intersect the candidate planes one by one through the virtual interface
+MicroBenchmarkResult candidatesTest(
+    const std::vector<const Surface*>& surfaces, const GeometryContext& gctx,
+    double phi, double theta) {
+  Vector3D direction(std::cos(phi) * std::sin(theta),
+                     std::sin(phi) * std::sin(theta), std::cos(theta));
+  std::vector<SurfaceIntersection> intersections;
+  intersections.reserve(surfaces.size());
+  return Acts::Test::microBenchmark(
+      [&] {
+        intersections.clear();
+        for (const auto& surface : surfaces) {
+          intersections.push_back(
+              surface->intersect(gctx, origin, direction, boundaryCheck));
+        }
+        return intersections.size();
+      },
+      nrepts);
+}
+
+/// Intersect the candidate planes in one go with the batch intersector
+MicroBenchmarkResult batchTest(const std::vector<const Surface*>& surfaces,
+                               const GeometryContext& gctx, double phi,
+                               double theta,
+                               const GeometryCache* cache = nullptr) {
+  Vector3D direction(std::cos(phi) * std::sin(theta),
+                     std::sin(phi) * std::sin(theta), std::cos(theta));
+  PlaneSurfaceBatch batch(surfaces);
+  std::vector<size_t> slots;
+  for (const auto& surface : surfaces) {
+    slots.push_back(batch.slot(surface));
+  }
+  std::vector<Intersection> intersections;
+  return Acts::Test::microBenchmark(
+      [&] {
+        batch.intersect(gctx, origin, direction, boundaryCheck, slots,
+                        intersections, cache);
+        return intersections.size();
+      },
+      nrepts);
+}
+
 BOOST_DATA_TEST_CASE(
     benchmark_surface_intersections,
     bdata::random(
@@ -124,6 +244,26 @@ BOOST_DATA_TEST_CASE(
               << intersectionTest<StrawSurface>(*aStraw, phi, theta + M_PI)
               << std::endl;
   }
+  if (testPlaneBatch) {
+    std::vector<const Surface*> planes;
+    for (const auto& plane : candidatePlanes) {
+      planes.push_back(plane.get());
+    }
+    std::cout << "- " << planes.size() << " Planes, individually: "
+              << candidatesTest(planes, tgContext, phi, theta) << std::endl;
+    std::cout << "- " << planes.size() << " Planes, batched: "
+              << batchTest(planes, tgContext, phi, theta) << std::endl;
+    // detector element planes, their placement depends on the context
+    std::vector<const Surface*> modules = candidateElementSurfaces();
+    std::cout << "- " << modules.size() << " Modules, individually: "
+              << candidatesTest(modules, alignedContext, phi, theta)
+              << std::endl;
+    std::cout << "- " << modules.size() << " Modules, batched: "
+              << batchTest(modules, alignedContext, phi, theta) << std::endl;
+    std::cout << "- " << modules.size() << " Modules, batched & cached: "
+              << batchTest(modules, alignedContext, phi, theta, &alignedCache)
+              << std::endl;
+  }
 }
 
 }  // namespace Test
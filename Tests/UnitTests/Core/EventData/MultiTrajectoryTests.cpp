@@ -11,12 +11,14 @@
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MultiTrajectoryExport.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackState.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <cstring>
 #include <iostream>
 
 using std::cout;
@@ -496,6 +498,198 @@ BOOST_AUTO_TEST_CASE(storage_consistency) {
       *ts.measurement.calibrated);
 }
 
+BOOST_AUTO_TEST_CASE(storage_growth) {
+  // the capacity grows geometrically
+  detail_lt::Types<eBoundParametersSize>::StorageCoefficients columns;
+  size_t nReallocations = 0;
+  size_t capacity = columns.capacity();
+  for (size_t i = 0; i < 10000; ++i) {
+    columns.addCol().setConstant(i);
+    if (columns.capacity() != capacity) {
+      nReallocations++;
+      capacity = columns.capacity();
+    }
+  }
+  BOOST_CHECK_EQUAL(columns.size(), 10000u);
+  BOOST_CHECK_LE(nReallocations, 12u);
+  // the content survives the reallocations
+  BOOST_CHECK_EQUAL(columns.col(0)[0], 0.);
+  BOOST_CHECK_EQUAL(columns.col(4321)[3], 4321.);
+
+  // reserving allocates exactly, but does not change the size
+  columns.reserve(20000);
+  BOOST_CHECK_EQUAL(columns.capacity(), 20000u);
+  BOOST_CHECK_EQUAL(columns.size(), 10000u);
+  BOOST_CHECK_EQUAL(columns.col(9999)[5], 9999.);
+}
+
+BOOST_AUTO_TEST_CASE(large_trajectory) {
+  namespace PM = TrackStatePropMask;
+  // more track states than representable with 16 bit indices
+  constexpr size_t nStates = 70000;
+
+  MultiTrajectory<SourceLink> t;
+  t.reserve(nStates, PM::Predicted | PM::Filtered);
+  size_t iprevious = SIZE_MAX;
+  for (size_t i = 0; i < nStates; ++i) {
+    iprevious = t.addTrackState(PM::Predicted | PM::Filtered, iprevious);
+    auto ts = t.getTrackState(iprevious);
+    ts.predicted()[eLOC_0] = i;
+    ts.filtered()[eLOC_0] = -1. * i;
+  }
+  BOOST_CHECK_EQUAL(t.size(), nStates);
+
+  size_t n = nStates;
+  bool consistent = true;
+  t.visitBackwards(iprevious, [&](const auto& ts) {
+    n--;
+    consistent = consistent and ts.index() == n and
+                 ts.predicted()[eLOC_0] == n and
+                 ts.filtered()[eLOC_0] == -1. * n;
+  });
+  BOOST_CHECK_EQUAL(n, 0u);
+  BOOST_CHECK(consistent);
+}
+
+BOOST_AUTO_TEST_CASE(columnar_views) {
+  using IndexData = detail_lt::IndexData;
+  MultiTrajectory<SourceLink> t;
+
+  auto [ts, fm, om] = make_trackstate();
+  auto i0 = t.addTrackState(ts);
+  auto i1 = t.addTrackState(TrackStatePropMask::Predicted, i0);
+  auto proxy = t.getTrackState(i1);
+  proxy.predicted().setConstant(3.);
+  proxy.chi2() = 5.;
+  proxy.pathLength() = 7.;
+
+  // predicted, filtered and smoothed of the first, predicted of the second
+  auto params = t.parametersColumns();
+  BOOST_CHECK_EQUAL(params.cols(), 4);
+  BOOST_CHECK_EQUAL(t.covarianceColumns().cols(), 4);
+  BOOST_CHECK_EQUAL(t.jacobianColumns().cols(), 1);
+  BOOST_CHECK_EQUAL(t.calibratedColumns().cols(), 1);
+  BOOST_CHECK_EQUAL(t.calibratedCovarianceColumns().cols(), 1);
+
+  // the views share the storage with the track states
+  auto predicted = t.indexColumn(&IndexData::ipredicted);
+  auto smoothed = t.indexColumn(&IndexData::ismoothed);
+  BOOST_CHECK_EQUAL(predicted.size(), 2);
+  BOOST_CHECK_EQUAL(params.col(predicted[i0]), t.getTrackState(i0).predicted());
+  BOOST_CHECK_EQUAL(params.col(smoothed[i0]), t.getTrackState(i0).smoothed());
+  BOOST_CHECK_EQUAL(params.col(predicted[i1]).data(), proxy.predicted().data());
+  BOOST_CHECK_EQUAL(smoothed[i1], IndexData::kInvalid);
+  BOOST_CHECK_EQUAL(t.indexColumn(&IndexData::iprevious)[i1], i0);
+
+  CovMat_t jac = Eigen::Map<const CovMat_t>(t.jacobianColumns().col(0).data());
+  BOOST_CHECK_EQUAL(jac, t.getTrackState(i0).jacobian());
+  BOOST_CHECK_EQUAL(t.chi2Column()[i0], 78.);
+  BOOST_CHECK_EQUAL(t.chi2Column()[i1], 5.);
+  BOOST_CHECK_EQUAL(t.pathLengthColumn()[i0], 42.);
+  BOOST_CHECK_EQUAL(t.pathLengthColumn()[i1], 7.);
+
+  // empty trajectory
+  MultiTrajectory<SourceLink> empty;
+  BOOST_CHECK_EQUAL(empty.parametersColumns().cols(), 0);
+  BOOST_CHECK_EQUAL(empty.chi2Column().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(truncate) {
+  MultiTrajectory<SourceLink> t;
+
+  // a first track which is kept
+  auto [ts, fm, om] = make_trackstate();
+  auto i0 = t.addTrackState(ts);
+  auto i1 = t.addTrackState(TrackStatePropMask::Predicted, i0);
+  t.getTrackState(i1).predicted().setConstant(3.);
+
+  // a second track which is removed again
+  auto i2 = t.addTrackState(ts);
+  t.addTrackState(TrackStatePropMask::All, i2);
+  BOOST_CHECK_EQUAL(t.size(), 4u);
+
+  t.truncate(5);
+  BOOST_CHECK_EQUAL(t.size(), 4u);
+  t.truncate(2);
+  BOOST_CHECK_EQUAL(t.size(), 2u);
+  BOOST_CHECK_EQUAL(t.parametersColumns().cols(), 4);
+  BOOST_CHECK_EQUAL(t.covarianceColumns().cols(), 4);
+  BOOST_CHECK_EQUAL(t.jacobianColumns().cols(), 1);
+  BOOST_CHECK_EQUAL(t.calibratedColumns().cols(), 1);
+  BOOST_CHECK_EQUAL(t.calibratedCovarianceColumns().cols(), 1);
+
+  // the kept track states are unchanged
+  auto ts0 = t.getTrackState(i0);
+  BOOST_CHECK_EQUAL(ts0.smoothed(), ts.parameter.smoothed->parameters());
+  BOOST_CHECK(ts0.uncalibrated() == *ts.measurement.uncalibrated);
+  BOOST_CHECK_EQUAL(t.getTrackState(i1).predicted(), Parameters::Constant(3.));
+
+  // new track states are added after the kept ones
+  auto i2new = t.addTrackState(ts);
+  BOOST_CHECK_EQUAL(i2new, 2u);
+  BOOST_CHECK_EQUAL(t.parametersColumns().cols(), 7);
+  BOOST_CHECK_EQUAL(t.getTrackState(i2new).filtered(),
+                    ts.parameter.filtered->parameters());
+
+  t.truncate(0);
+  BOOST_CHECK_EQUAL(t.size(), 0u);
+  BOOST_CHECK_EQUAL(t.parametersColumns().cols(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(flat_export) {
+  namespace Export = MultiTrajectoryExport;
+  MultiTrajectory<SourceLink> t;
+
+  auto [ts, fm, om] = make_trackstate();
+  auto i0 = t.addTrackState(ts);
+  auto i1 = t.addTrackState(TrackStatePropMask::Predicted, i0);
+  t.getTrackState(i1).predicted().setConstant(3.);
+
+  std::vector<char> buffer = Export::write(t);
+
+  Export::HeaderRecord header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  BOOST_CHECK_EQUAL(std::string(header.magic), std::string(Export::kMagic));
+  BOOST_CHECK_EQUAL(header.version, Export::kVersion);
+  BOOST_CHECK_EQUAL(header.parametersSize, 6u);
+  const auto& states = header.sections[Export::eStates];
+  const auto& parameters = header.sections[Export::eParameters];
+  const auto& calibratedCov = header.sections[Export::eCalibratedCovariances];
+  BOOST_CHECK_EQUAL(states.count, 2u);
+  BOOST_CHECK_EQUAL(parameters.count, 4u);
+  BOOST_CHECK_EQUAL(calibratedCov.offset + calibratedCov.count * 36 * 8,
+                    buffer.size());
+
+  std::vector<Export::StateRecord> records(states.count);
+  std::memcpy(records.data(), buffer.data() + states.offset,
+              states.count * sizeof(Export::StateRecord));
+  BOOST_CHECK_EQUAL(records[0].geoID,
+                    ts.referenceSurface().geoID().value());
+  BOOST_CHECK_EQUAL(records[0].previous, Export::kInvalid);
+  BOOST_CHECK_EQUAL(records[0].measurementSize, 3u);
+  BOOST_CHECK_EQUAL(records[0].chi2, 78.);
+  BOOST_CHECK_EQUAL(records[0].pathLength, 42.);
+  BOOST_CHECK_EQUAL(records[1].geoID, 0u);
+  BOOST_CHECK_EQUAL(records[1].previous, i0);
+  BOOST_CHECK_EQUAL(records[1].filtered, Export::kInvalid);
+
+  // the parameter block is a plain copy of the storage
+  std::vector<double> values(parameters.count * 6);
+  std::memcpy(values.data(), buffer.data() + parameters.offset,
+              values.size() * sizeof(double));
+  ParVec_t filtered = Eigen::Map<ParVec_t>(&values[6 * records[0].filtered]);
+  ParVec_t predicted = Eigen::Map<ParVec_t>(&values[6 * records[1].predicted]);
+  BOOST_CHECK_EQUAL(filtered, ts.parameter.filtered->parameters());
+  BOOST_CHECK_EQUAL(predicted, ParVec_t::Constant(3.));
+}
+
+BOOST_AUTO_TEST_CASE(index_overflow) {
+  using IndexData = detail_lt::IndexData;
+  BOOST_CHECK_EQUAL(IndexData::checkedIndex(65535u), 65535u);
+  BOOST_CHECK_THROW(IndexData::checkedIndex(IndexData::kInvalid),
+                    std::out_of_range);
+}
+
 }  // namespace Test
 
 }  // namespace Acts
@@ -8,6 +8,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <array>
 #include <cmath>
 #include <memory>
 #include <random>
@@ -483,6 +484,25 @@ BOOST_AUTO_TEST_CASE(parset_projection_tests) {
   BOOST_CHECK((ParameterSet<eBoundLoc0, eBoundLoc1, eBoundPhi, eBoundTheta,
                             eBoundQOverP, eT>::projector() ==
                loc0_loc1_phi_theta_qop_t_proj));
+
+  // the index tables select the same parameters as the projection matrices
+  using ParSet_t = ParameterSet<eBoundLoc0, eBoundPhi, eBoundTheta>;
+  const std::array<unsigned int, 3> indices{eBoundLoc0, eBoundPhi,
+                                            eBoundTheta};
+  BOOST_CHECK(ParSet_t::indices == indices);
+  BoundVector full;
+  full << 0.3, -1.2, 0.9 * M_PI, 0.2 * M_PI, 0.01, 42.;
+  BOOST_CHECK((ParSet_t::project(full) == ParSet_t::projector() * full));
+
+  // residuals with respect to a full vector are corrected as for the
+  // residuals with respect to the projected parameter set
+  ParSet_t parSet(std::nullopt, 2.7, -0.9 * M_PI, 0.35 * M_PI);
+  ParSet_t projected(std::nullopt, ParSet_t::project(full));
+  CHECK_CLOSE_REL(parSet.residual(full), parSet.residual(projected), 1e-12);
+  full[eBoundTheta] = 1.2 * M_PI;
+  full[eBoundPhi] = 3 * M_PI;
+  projected = ParSet_t(std::nullopt, ParSet_t::project(full));
+  CHECK_CLOSE_REL(parSet.residual(full), parSet.residual(projected), 1e-12);
 }
 
 /**
@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <random>
+
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/CholeskySmoother.hpp"
+#include "Acts/Fitter/GainMatrixSmoother.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+using SourceLink = MinimalSourceLink;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+/// Fill a trajectory with consistent filtered and predicted states, i.e.
+/// the predicted covariance is the transported filtered covariance of the
+/// previous state plus some process noise. The parameters in @p exact are
+/// known exactly, i.e. their covariance is zero everywhere.
+size_t fillTrajectory(MultiTrajectory<SourceLink>& traj, size_t nStates,
+                      const std::vector<ParID_t>& exact = {}) {
+  std::mt19937 rng(4711);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  auto random = [&]() { return uniform(rng); };
+  auto dropExact = [&](auto& matrix) {
+    for (ParID_t par : exact) {
+      matrix.row(par).setZero();
+      matrix.col(par).setZero();
+    }
+  };
+
+  auto surface = Surface::makeShared<PlaneSurface>(Vector3D::UnitX(),
+                                                   Vector3D::UnitX());
+  Covariance noise = 0.01 * Covariance::Identity();
+  dropExact(noise);
+
+  size_t index = SIZE_MAX;
+  BoundVector parameters = BoundVector::NullaryExpr(random);
+  Covariance filtered = Covariance::Identity();
+  dropExact(filtered);
+  Covariance jacobian = Covariance::Identity();
+  for (size_t i = 0; i < nStates; ++i) {
+    index = traj.addTrackState(TrackStatePropMask::All, index);
+    auto ts = traj.getTrackState(index);
+    ts.setReferenceSurface(surface);
+
+    // the smoother expects the transport to the next state on each state
+    ts.predicted() = parameters;
+    ts.predictedCovariance() =
+        jacobian * filtered * jacobian.transpose() + noise;
+
+    // gain matrix update with a measurement of the local position
+    const Covariance predicted = ts.predictedCovariance();
+    const ActsSymMatrixD<2> S = predicted.topLeftCorner<2, 2>() +
+                                0.01 * ActsSymMatrixD<2>::Identity();
+    const ActsMatrixD<eBoundParametersSize, 2> K =
+        predicted.leftCols<2>() * S.inverse();
+    filtered = predicted - K * predicted.topRows<2>();
+    parameters += K * ActsVectorD<2>(0.1 * random(), 0.1 * random());
+    ts.filtered() = parameters;
+    ts.filteredCovariance() = filtered;
+    ts.pathLength() = i;
+
+    jacobian = Covariance::Identity() + 0.1 * Covariance::NullaryExpr(random);
+    for (ParID_t par : exact) {
+      jacobian.row(par).setZero();
+      jacobian.col(par).setZero();
+      jacobian(par, par) = 1.;
+    }
+    ts.jacobian() = jacobian;
+  }
+  return index;
+}
+
+BOOST_AUTO_TEST_CASE(cholesky_smoother_matches_gain_matrix_smoother) {
+  MultiTrajectory<SourceLink> reference;
+  MultiTrajectory<SourceLink> traj;
+  size_t lastIndex = fillTrajectory(reference, 15);
+  BOOST_CHECK_EQUAL(fillTrajectory(traj, 15), lastIndex);
+
+  GainMatrixSmoother<BoundParameters> gms;
+  auto expRes = gms(tgContext, reference, lastIndex);
+  BOOST_REQUIRE(expRes.ok());
+  CholeskySmoother<BoundParameters> cs;
+  auto res = cs(tgContext, traj, lastIndex);
+  BOOST_REQUIRE(res.ok());
+  const auto& expSmoothed = *expRes;
+  const auto& smoothed = *res;
+  CHECK_CLOSE_ABS(smoothed.parameters(), expSmoothed.parameters(), 1e-9);
+
+  for (size_t i = 0; i <= lastIndex; ++i) {
+    auto expected = reference.getTrackState(i);
+    auto ts = traj.getTrackState(i);
+    BOOST_CHECK(ts.hasSmoothed());
+    CHECK_CLOSE_ABS(ts.smoothed(), expected.smoothed(), 1e-9);
+    CHECK_CLOSE_ABS(ts.smoothedCovariance(), expected.smoothedCovariance(),
+                    1e-9);
+    // the smoothed covariances are exactly symmetric
+    if (i != lastIndex) {
+      BOOST_CHECK(ts.smoothedCovariance() ==
+                  ts.smoothedCovariance().transpose());
+    }
+  }
+  // last one, smoothed == filtered
+  auto last = traj.getTrackState(lastIndex);
+  BOOST_CHECK_EQUAL(last.filtered(), last.smoothed());
+}
+
+BOOST_AUTO_TEST_CASE(cholesky_smoother_exact_parameter) {
+  // The time is known exactly, i.e. has a vanishing variance, which makes
+  // the predicted covariance singular.
+  MultiTrajectory<SourceLink> traj;
+  size_t lastIndex = fillTrajectory(traj, 10, {eT});
+
+  CholeskySmoother<BoundParameters> cs;
+  BOOST_REQUIRE(cs(tgContext, traj, lastIndex).ok());
+  for (size_t i = 0; i <= lastIndex; ++i) {
+    auto ts = traj.getTrackState(i);
+    BOOST_CHECK(ts.smoothed().allFinite());
+    BOOST_CHECK(ts.smoothedCovariance().allFinite());
+    // the exactly known time is not changed by the smoother
+    CHECK_CLOSE_ABS(ts.smoothed()[eT], ts.filtered()[eT], 1e-12);
+    CHECK_SMALL(ts.smoothedCovariance().row(eT).norm(), 1e-12);
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,234 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/CombinatorialKalmanFilter.hpp"
+#include "Acts/Fitter/GainMatrixUpdater.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+#include "FitterTestsCommon.hpp"
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using SourceLink = MinimalSourceLink;
+using Measurement2D = Measurement<SourceLink, eLOC_0, eLOC_1>;
+
+using RecoPropagator = FitterTestsFixture::Propagator;
+using Updater = GainMatrixUpdater<BoundParameters>;
+using CombinatorialKalmanFilter =
+    Acts::CombinatorialKalmanFilter<RecoPropagator, Updater>;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+CalibrationContext calContext = CalibrationContext();
+
+/// Three tracks, the first one is searched for
+struct Fixture : public FitterTestsFixture {
+  // The y/z offsets of the tracks at the start
+  std::vector<Vector2D> offsets = {
+      {0., 0.}, {100_mm, 20_mm}, {-100_mm, -20_mm}};
+
+  /// @param bz The magnetic field along z
+  Fixture(double bz = 0.) : FitterTestsFixture(tgContext, mfContext, bz) {
+    for (const auto& offset : offsets) {
+      simulate(startParameters(offset));
+    }
+  }
+
+  CombinatorialKalmanFilter makeFilter() const {
+    return CombinatorialKalmanFilter(makePropagator());
+  }
+};
+
+/// Add a copy of a measurement, shifted in the first local coordinate
+void addShiftedMeasurement(Fixture& fixture, size_t index, double shift) {
+  const auto& measurement =
+      std::get<Measurement2D>(fixture.measurements[index]);
+  auto shifted = Measurement2D(measurement.referenceSurface().getSharedPtr(),
+                               {}, measurement.covariance(),
+                               measurement.parameters()[0] + shift,
+                               measurement.parameters()[1]);
+  fixture.measurements.push_back(std::move(shifted));
+}
+
+/// The source links of a track candidate, from the last to the first
+std::vector<SourceLink> candidateSourceLinks(
+    const MultiTrajectory<SourceLink>& trajectory, size_t tip) {
+  std::vector<SourceLink> sourcelinks;
+  trajectory.visitBackwards(tip, [&](const auto& ts) {
+    if (ts.hasUncalibrated()) {
+      sourcelinks.push_back(ts.uncalibrated());
+    }
+  });
+  return sourcelinks;
+}
+
+/// The track state indices of a track candidate, from the first to the last
+std::vector<size_t> candidateStates(
+    const MultiTrajectory<SourceLink>& trajectory, size_t tip) {
+  std::vector<size_t> states;
+  trajectory.visitBackwards(
+      tip, [&](const auto& ts) { states.push_back(ts.index()); });
+  std::reverse(states.begin(), states.end());
+  return states;
+}
+
+BOOST_AUTO_TEST_CASE(combinatorial_kalman_filter_single_track) {
+  // Straight and curved tracks
+  for (double bz : {0., 0.1_T}) {
+    Fixture fixture(bz);
+    auto sourcelinks = fixture.sourceLinks();
+    BOOST_CHECK_EQUAL(sourcelinks.size(), 18u);
+
+    auto ckf = fixture.makeFilter();
+    CombinatorialKalmanFilterOptions ckfOptions(tgContext, mfContext,
+                                                calContext);
+
+    // The other tracks are far away and not compatible
+    auto start = fixture.startParameters(fixture.offsets[0]);
+    auto res = ckf.findTracks(sourcelinks, start, ckfOptions);
+    BOOST_REQUIRE(res.ok());
+    const auto& result = *res;
+    BOOST_REQUIRE_EQUAL(result.trackTips.size(), 1u);
+    BOOST_CHECK(result.activeBranches.empty());
+
+    auto found = candidateSourceLinks(result.fittedStates, result.trackTips[0]);
+    BOOST_CHECK_EQUAL(found.size(), 6u);
+    for (const auto& sourcelink : found) {
+      auto it = std::find(sourcelinks.begin(), sourcelinks.end(), sourcelink);
+      // the measurements of the first track come first
+      BOOST_CHECK(it - sourcelinks.begin() < 6);
+    }
+
+    // Without any compatible measurement nothing is found
+    auto away = fixture.startParameters({300_mm, 300_mm});
+    BOOST_CHECK(!ckf.findTracks(sourcelinks, away, ckfOptions).ok());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(combinatorial_kalman_filter_branching) {
+  Fixture fixture;
+  // A second compatible measurement on the third surface
+  const Surface& branchSurface = fixture.cGeometry.detectorStore[2]->surface();
+  addShiftedMeasurement(fixture, 2, 0.2_mm);
+  auto sourcelinks = fixture.sourceLinks();
+  const SourceLink& extra = sourcelinks.back();
+  auto start = fixture.startParameters(fixture.offsets[0]);
+
+  auto ckf = fixture.makeFilter();
+  CombinatorialKalmanFilterOptions ckfOptions(tgContext, mfContext,
+                                              calContext);
+
+  // Only the best candidate is followed
+  ckfOptions.maxBranchesPerSurface = 1;
+  auto res = ckf.findTracks(sourcelinks, start, ckfOptions);
+  BOOST_REQUIRE(res.ok());
+  BOOST_CHECK_EQUAL((*res).trackTips.size(), 1u);
+
+  // Both candidates are followed
+  ckfOptions.maxBranchesPerSurface = 2;
+  res = ckf.findTracks(sourcelinks, start, ckfOptions);
+  BOOST_REQUIRE(res.ok());
+  const auto& result = *res;
+  BOOST_REQUIRE_EQUAL(result.trackTips.size(), 2u);
+
+  const auto& trajectory = result.fittedStates;
+  std::vector<std::vector<SourceLink>> found;
+  for (size_t tip : result.trackTips) {
+    found.push_back(candidateSourceLinks(trajectory, tip));
+    BOOST_CHECK_EQUAL(found.back().size(), 6u);
+  }
+  auto hasExtra = [&](const std::vector<SourceLink>& candidate) {
+    return std::find(candidate.begin(), candidate.end(), extra) !=
+           candidate.end();
+  };
+  BOOST_CHECK_NE(hasExtra(found[0]), hasExtra(found[1]));
+
+  // The track states before the branching point are shared
+  auto states0 = candidateStates(trajectory, result.trackTips[0]);
+  auto states1 = candidateStates(trajectory, result.trackTips[1]);
+  BOOST_REQUIRE_EQUAL(states0.size(), states1.size());
+  for (size_t i = 0; i < states0.size(); ++i) {
+    auto ts = trajectory.getTrackState(states0[i]);
+    if (&ts.referenceSurface() == &branchSurface) {
+      BOOST_CHECK_NE(states0[i], states1[i]);
+      // the branches share the prediction on the branching surface
+      auto ts1 = trajectory.getTrackState(states1[i]);
+      BOOST_CHECK_EQUAL(ts.data().ipredicted, ts1.data().ipredicted);
+      BOOST_CHECK_EQUAL(ts.data().ijacobian, ts1.data().ijacobian);
+      BOOST_CHECK_NE(ts.data().ifiltered, ts1.data().ifiltered);
+      break;
+    }
+    BOOST_CHECK_EQUAL(states0[i], states1[i]);
+  }
+
+  // Pruning by the total number of branches
+  ckfOptions.maxBranches = 1;
+  res = ckf.findTracks(sourcelinks, start, ckfOptions);
+  BOOST_REQUIRE(res.ok());
+  BOOST_CHECK_EQUAL((*res).trackTips.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(combinatorial_kalman_filter_branch_limits) {
+  // Curved tracks, with two candidates on the third surface
+  Fixture fixture(0.1_T);
+  addShiftedMeasurement(fixture, 2, 0.2_mm);
+  auto sourcelinks = fixture.sourceLinks();
+  auto start = fixture.startParameters(fixture.offsets[0]);
+
+  auto ckf = fixture.makeFilter();
+  CombinatorialKalmanFilterOptions ckfOptions(tgContext, mfContext,
+                                              calContext);
+  ckfOptions.maxBranchesPerSurface = 2;
+
+  // The number of measurements of each found candidate
+  auto nMeasurements = [](const auto& result) {
+    std::vector<size_t> n;
+    for (size_t tip : result.trackTips) {
+      n.push_back(candidateSourceLinks(result.fittedStates, tip).size());
+    }
+    return n;
+  };
+
+  // The path limit only ends the current branch. The best candidate stops
+  // before the last two surfaces, the other one is resumed on the third
+  // surface and reaches the end of the world.
+  ckfOptions.pathLimit = 4.5_m;
+  auto res = ckf.findTracks(sourcelinks, start, ckfOptions);
+  BOOST_REQUIRE(res.ok());
+  BOOST_CHECK((*res).activeBranches.empty());
+  BOOST_CHECK(nMeasurements(*res) == (std::vector<size_t>{4, 6}));
+
+  // The step limit ends the whole search. The best candidate is cut after
+  // the fourth surface and the pending one on the third surface is kept.
+  ckfOptions.pathLimit = std::numeric_limits<double>::max();
+  ckfOptions.maxSteps = 25;
+  res = ckf.findTracks(sourcelinks, start, ckfOptions);
+  BOOST_REQUIRE(res.ok());
+  BOOST_CHECK((*res).activeBranches.empty());
+  BOOST_CHECK(nMeasurements(*res) == (std::vector<size_t>{4, 3}));
+}
+
+}  // namespace Test
+}  // namespace Acts
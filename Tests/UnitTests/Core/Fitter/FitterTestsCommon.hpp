@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/StandardAborters.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace Acts {
+namespace Test {
+
+/// @brief This struct creates a 2D measurement on each sensitive surface
+/// crossed by the propagation, at the track position without smearing
+struct SensitiveMeasurementCreator {
+  using Measurement2D = Measurement<MinimalSourceLink, eLOC_0, eLOC_1>;
+
+  /// The covariance of the measurements
+  ActsSymMatrixD<2> covariance = ActsSymMatrixD<2>::Identity();
+
+  struct this_result {
+    // The measurements in the order of the crossed surfaces
+    std::vector<FittableMeasurement<MinimalSourceLink>> measurements;
+  };
+
+  using result_type = this_result;
+
+  /// @brief Operater that is callable by an ActionList
+  ///
+  /// @tparam propagator_state_t Type of the propagator state
+  /// @tparam stepper_t Type of the stepper
+  /// @param [in] state State of the propagator
+  /// @param [in] stepper The stepper in use
+  /// @param [out] result The created measurements
+  template <typename propagator_state_t, typename stepper_t>
+  void operator()(propagator_state_t& state, const stepper_t& stepper,
+                  result_type& result) const {
+    auto surface = state.navigation.currentSurface;
+    if (surface != nullptr and surface->associatedDetectorElement()) {
+      Vector2D lPos;
+      surface->globalToLocal(state.geoContext,
+                             stepper.position(state.stepping),
+                             stepper.direction(state.stepping), lPos);
+      result.measurements.push_back(
+          Measurement2D(surface->getSharedPtr(), {}, covariance, lPos[eLOC_0],
+                        lPos[eLOC_1]));
+    }
+  }
+};
+
+/// @brief The cubic test detector in a constant magnetic field along z for
+/// the track finding and fitting tests
+///
+/// The tracks start at x = -3 m in the direction of the x-axis and their
+/// measurements are simulated without material effects.
+struct FitterTestsFixture {
+  using SourceLink = MinimalSourceLink;
+  using Stepper = EigenStepper<ConstantBField>;
+  using Propagator = Acts::Propagator<Stepper, Navigator>;
+
+  /// Constructor
+  ///
+  /// @param gctx The geometry context of the tests
+  /// @param mctx The magnetic field context of the tests
+  /// @param bz The magnetic field along z
+  FitterTestsFixture(const GeometryContext& gctx,
+                     const MagneticFieldContext& mctx, double bz = 0.)
+      : geoContext(gctx),
+        magFieldContext(mctx),
+        cGeometry(gctx),
+        detector(cGeometry()),
+        bField(0., 0., bz) {}
+
+  const GeometryContext& geoContext;
+  const MagneticFieldContext& magFieldContext;
+
+  CubicTrackingGeometry cGeometry;
+  std::shared_ptr<const TrackingGeometry> detector;
+  ConstantBField bField;
+
+  /// The covariance of the simulated measurements
+  ActsSymMatrixD<2> cov2D = ActsSymMatrixD<2>::Identity() * 50 *
+                            UnitConstants::um * 50 * UnitConstants::um;
+
+  /// The measurements of all simulated tracks
+  std::vector<FittableMeasurement<SourceLink>> measurements;
+
+  /// The propagator for the simulation and the reconstruction
+  Propagator makePropagator() const {
+    Navigator navigator(detector);
+    navigator.resolvePassive = false;
+    navigator.resolveMaterial = true;
+    navigator.resolveSensitive = true;
+    return Propagator(Stepper(bField), std::move(navigator));
+  }
+
+  /// The start parameters of a track
+  ///
+  /// @param offset The y/z position of the start
+  /// @param charge The charge of the particle
+  /// @param momentum The momentum of the particle
+  CurvilinearParameters startParameters(
+      const Vector2D& offset, double charge = 1.,
+      double momentum = 1 * UnitConstants::GeV) const {
+    BoundSymMatrix cov = BoundSymMatrix::Zero();
+    cov.diagonal() << 1 * UnitConstants::mm * UnitConstants::mm,
+        1 * UnitConstants::mm * UnitConstants::mm, 1e-4, 1e-4, 0.01, 1.;
+    return CurvilinearParameters(
+        cov, Vector3D(-3 * UnitConstants::m, offset.x(), offset.y()),
+        Vector3D(momentum, 0., 0.), charge, 42.);
+  }
+
+  /// Simulate a track and append its measurements
+  ///
+  /// @param start The true start parameters of the track
+  ///
+  /// @return the number of measurements of the track
+  size_t simulate(const CurvilinearParameters& start) {
+    using Actors = ActionList<SensitiveMeasurementCreator>;
+    using Aborters = AbortList<detail::EndOfWorldReached>;
+
+    PropagatorOptions<Actors, Aborters> options(geoContext, magFieldContext);
+    options.actionList.get<SensitiveMeasurementCreator>().covariance = cov2D;
+
+    auto result = makePropagator().propagate(start, options);
+    if (!result.ok()) {
+      throw std::runtime_error("Simulation of a test track failed");
+    }
+    auto& created =
+        (*result)
+            .template get<SensitiveMeasurementCreator::result_type>()
+            .measurements;
+    measurements.insert(measurements.end(),
+                        std::make_move_iterator(created.begin()),
+                        std::make_move_iterator(created.end()));
+    return created.size();
+  }
+
+  /// The source links to all measurements, which are invalidated when
+  /// measurements are added
+  std::vector<SourceLink> sourceLinks() const {
+    std::vector<SourceLink> sourcelinks;
+    std::transform(measurements.begin(), measurements.end(),
+                   std::back_inserter(sourcelinks),
+                   [](const auto& m) { return SourceLink{&m}; });
+    return sourcelinks;
+  }
+};
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,232 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/GainMatrixSmoother.hpp"
+#include "Acts/Fitter/GainMatrixUpdater.hpp"
+#include "Acts/Fitter/GaussianSumFitter.hpp"
+#include "Acts/Fitter/KalmanFitter.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+#include "FitterTestsCommon.hpp"
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using SourceLink = MinimalSourceLink;
+
+using RecoPropagator = FitterTestsFixture::Propagator;
+using GaussianSumFitter = Acts::GaussianSumFitter<RecoPropagator>;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+CalibrationContext calContext = CalibrationContext();
+
+BOOST_AUTO_TEST_CASE(bethe_heitler_approx) {
+  detail::BetheHeitlerApprox bha;
+  for (double x0 : {0.001, 0.01, 0.05, 0.2}) {
+    auto mixture = bha.mixture(x0);
+    BOOST_CHECK_EQUAL(mixture.size(), bha.nComponents);
+    double sumWeights = 0.;
+    double mean = 0.;
+    double meanSquare = 0.;
+    for (const auto& cmp : mixture) {
+      BOOST_CHECK_GT(cmp.mean, 0.);
+      BOOST_CHECK_LE(cmp.mean, 1.);
+      BOOST_CHECK_GE(cmp.variance, 0.);
+      sumWeights += cmp.weight;
+      mean += cmp.weight * cmp.mean;
+      meanSquare += cmp.weight * (cmp.variance + cmp.mean * cmp.mean);
+    }
+    // The mixture has the moments of the Bethe-Heitler distribution
+    const double c = x0 / std::log(2.);
+    CHECK_CLOSE_REL(sumWeights, 1., 1e-12);
+    CHECK_CLOSE_REL(mean, std::pow(2., -c), 1e-6);
+    CHECK_CLOSE_REL(meanSquare, std::pow(3., -c), 1e-6);
+  }
+
+  // No energy loss without material
+  auto mixture = bha.mixture(0.);
+  BOOST_CHECK_EQUAL(mixture.size(), 1u);
+  BOOST_CHECK_EQUAL(mixture.front().mean, 1.);
+  BOOST_CHECK_EQUAL(mixture.front().variance, 0.);
+}
+
+BOOST_AUTO_TEST_CASE(gaussian_mixture_reduction) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0.1, 1.);
+  auto random = [&]() { return uniform(rng); };
+  detail::GaussianMixture mixture;
+  for (size_t ic = 0; ic < 30; ++ic) {
+    BoundVector parameters = BoundVector::NullaryExpr(random);
+    BoundMatrix a = BoundMatrix::NullaryExpr(random);
+    mixture.push_back({random(), parameters, a * a.transpose()});
+  }
+  detail::normalizeWeights(mixture);
+  auto [expMean, expCovariance] = detail::collapse(mixture);
+
+  detail::reduceMixture(mixture, 12);
+  BOOST_CHECK_EQUAL(mixture.size(), 12u);
+  BOOST_CHECK(std::is_sorted(
+      mixture.begin(), mixture.end(), [](const auto& a, const auto& b) {
+        return a.parameters[eQOP] < b.parameters[eQOP];
+      }));
+  // The merging keeps the mean and covariance of the mixture
+  auto [mean, covariance] = detail::collapse(mixture);
+  CHECK_CLOSE_ABS(mean, expMean, 1e-12);
+  CHECK_CLOSE_ABS(covariance, expCovariance, 1e-12);
+
+  detail::reduceMixture(mixture, 1);
+  BOOST_CHECK_EQUAL(mixture.size(), 1u);
+  CHECK_CLOSE_REL(mixture.front().weight, 1., 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(gaussian_mixture_weight_cutoff) {
+  detail::GaussianMixture mixture;
+  for (double weight : {0.1, 0.5, 0.05, 0.35}) {
+    BoundVector parameters = BoundVector::Constant(weight);
+    mixture.push_back({weight, parameters, BoundSymMatrix::Identity()});
+  }
+
+  // Only the components above the cutoff are kept & renormalised
+  detail::GaussianMixture reduced = mixture;
+  detail::removeLowWeights(reduced, 0.2);
+  BOOST_CHECK_EQUAL(reduced.size(), 2u);
+  CHECK_CLOSE_REL(reduced[0].weight, 0.5 / 0.85, 1e-12);
+  CHECK_CLOSE_REL(reduced[1].weight, 0.35 / 0.85, 1e-12);
+
+  // A cutoff above all weights keeps the best component
+  reduced = mixture;
+  detail::removeLowWeights(reduced, 0.9);
+  BOOST_REQUIRE_EQUAL(reduced.size(), 1u);
+  CHECK_CLOSE_REL(reduced.front().weight, 1., 1e-12);
+  CHECK_CLOSE_REL(reduced.front().parameters[eQOP], 0.5, 1e-12);
+}
+
+/// Measurements of an electron track
+struct Fixture : public FitterTestsFixture {
+  CurvilinearParameters start;
+  std::vector<SourceLink> sourcelinks;
+
+  RecoPropagator propagator;
+
+  /// @param bz The magnetic field along z
+  Fixture(double bz = 0.)
+      : FitterTestsFixture(tgContext, mfContext, bz),
+        start(startParameters({10_mm, -10_mm}, -1.)),
+        propagator(makePropagator()) {
+    simulate(start);
+    sourcelinks = sourceLinks();
+  }
+};
+
+BOOST_AUTO_TEST_CASE(gaussian_sum_fitter_single_component) {
+  // Without energy loss the mixture stays a single component, i.e. the
+  // fitter is a Kalman filter, for straight and curved tracks
+  for (double bz : {0., 0.1_T}) {
+    Fixture fixture(bz);
+    const auto& start = fixture.start;
+    GaussianSumFitter gsf(fixture.propagator);
+    GaussianSumFitterOptions gsfOptions(tgContext, mfContext, calContext,
+                                        true, false);
+    // The particle of the KalmanFitter
+    gsfOptions.absPdgCode = 211;
+    gsfOptions.mass = 139.57018_MeV;
+    auto res = gsf.fit(fixture.sourcelinks, start, gsfOptions);
+    BOOST_REQUIRE(res.ok());
+    const auto& result = *res;
+    BOOST_CHECK_EQUAL(result.measurementStates, 6u);
+    BOOST_CHECK_EQUAL(result.components.size(), 1u);
+    BOOST_CHECK(result.fittedParameters);
+
+    using KalmanFitter =
+        Acts::KalmanFitter<RecoPropagator, GainMatrixUpdater<BoundParameters>,
+                           GainMatrixSmoother<BoundParameters>>;
+    KalmanFitter kf(fixture.propagator);
+    KalmanFitterOptions<VoidOutlierFinder> kfOptions(
+        tgContext, mfContext, calContext, VoidOutlierFinder(),
+        &start.referenceSurface(), true, false);
+    auto kfRes = kf.fit(fixture.sourcelinks, start, kfOptions);
+    BOOST_REQUIRE(kfRes.ok());
+    const auto& kfResult = *kfRes;
+
+    std::vector<size_t> states;
+    std::vector<size_t> kfStates;
+    result.fittedStates.visitBackwards(
+        result.trackTip, [&](const auto& ts) { states.push_back(ts.index()); });
+    kfResult.fittedStates.visitBackwards(
+        kfResult.trackTip,
+        [&](const auto& ts) { kfStates.push_back(ts.index()); });
+    BOOST_REQUIRE_EQUAL(states.size(), kfStates.size());
+    for (size_t i = 0; i < states.size(); ++i) {
+      auto ts = result.fittedStates.getTrackState(states[i]);
+      auto kfTs = kfResult.fittedStates.getTrackState(kfStates[i]);
+      BOOST_CHECK_EQUAL(&ts.referenceSurface(), &kfTs.referenceSurface());
+      CHECK_CLOSE_ABS(ts.filtered(), kfTs.filtered(), 1e-6);
+      CHECK_CLOSE_ABS(ts.filteredCovariance(), kfTs.filteredCovariance(),
+                      1e-9);
+      CHECK_CLOSE_OR_SMALL(ts.chi2(), kfTs.chi2(), 1e-6, 1e-9);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(gaussian_sum_fitter_bethe_heitler) {
+  Fixture fixture;
+  GaussianSumFitter gsf(fixture.propagator);
+  GaussianSumFitterOptions gsfOptions(tgContext, mfContext, calContext);
+  gsfOptions.maxComponents = 8;
+  const auto& start = fixture.start;
+  auto res = gsf.fit(fixture.sourcelinks, start, gsfOptions);
+  BOOST_REQUIRE(res.ok());
+  const auto& result = *res;
+  BOOST_CHECK_EQUAL(result.measurementStates, 6u);
+
+  // The number of components is bounded, the weights are normalised
+  BOOST_CHECK_GT(result.components.size(), 1u);
+  BOOST_CHECK_LE(result.components.size(), gsfOptions.maxComponents);
+  double sumWeights = 0.;
+  for (const auto& cmp : result.components) {
+    sumWeights += cmp.weight;
+  }
+  CHECK_CLOSE_REL(sumWeights, 1., 1e-12);
+
+  // The electron loses energy along the track, which is not constrained by
+  // the measurements of a straight track
+  auto last = result.fittedStates.getTrackState(result.trackTip);
+  BOOST_CHECK_LT(last.filtered()[eQOP], start.parameters()[eQOP]);
+  double lastQOverP = -std::numeric_limits<double>::infinity();
+  result.fittedStates.visitBackwards(result.trackTip, [&](const auto& ts) {
+    BOOST_CHECK(ts.filtered().allFinite());
+    BOOST_CHECK(ts.filteredCovariance().allFinite());
+    BOOST_CHECK_GE(ts.filtered()[eQOP], lastQOverP);
+    lastQOverP = ts.filtered()[eQOP];
+    // the track position is found
+    CHECK_SMALL(ts.filtered()[eLOC_0] - ts.effectiveCalibrated()[0], 0.1_mm);
+  });
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -477,6 +477,121 @@ BOOST_AUTO_TEST_CASE(kalman_fitter_zero_field) {
     }
   });
   BOOST_CHECK_EQUAL(nOutliers, 1u);
+
+  // Reference fit with a hole in backward filtering mode
+  fitRes = kFitter.fit(measurementsWithHole, rStart, kfOptions);
+  BOOST_CHECK(fitRes.ok());
+  auto fittedWithHoleBwdParameters = (*fitRes).fittedParameters.value();
+
+  // Fit two tracks into a trajectory shared between the fits, with the
+  // detached states of the backward filtering
+  MultiTrajectory<SourceLink> sharedStates;
+  auto sharedRes = kFitter.fit(sourcelinks, rStart, kfOptions, &sharedStates);
+  BOOST_CHECK(sharedRes.ok());
+  auto sharedWithHoleRes =
+      kFitter.fit(measurementsWithHole, rStart, kfOptions, &sharedStates);
+  BOOST_CHECK(sharedWithHoleRes.ok());
+  auto& sharedTrack = *sharedRes;
+  auto& sharedWithHoleTrack = *sharedWithHoleRes;
+
+  // The track states are only stored in the shared trajectory
+  BOOST_CHECK_EQUAL(&sharedTrack.trajectory(), &sharedStates);
+  BOOST_CHECK_EQUAL(&sharedWithHoleTrack.trajectory(), &sharedStates);
+
+  // The fits are unchanged
+  auto sharedParameters = sharedTrack.fittedParameters.value();
+  auto sharedWithHoleParameters = sharedWithHoleTrack.fittedParameters.value();
+  auto bwdParameters = fittedWithBwdFiltering.fittedParameters.value();
+  CHECK_CLOSE_REL(bwdParameters.parameters().template head<5>(),
+                  sharedParameters.parameters().template head<5>(), 1e-5);
+  CHECK_CLOSE_REL(fittedWithHoleBwdParameters.parameters().template head<5>(),
+                  sharedWithHoleParameters.parameters().template head<5>(),
+                  1e-5);
+
+  // Both tracks are separate sub-trajectories of the shared trajectory
+  size_t nShared = 0;
+  size_t nSharedWithHole = 0;
+  size_t firstWithHole = sharedStates.size();
+  sharedStates.visitBackwards(sharedTrack.trackTip,
+                              [&](const auto&) { nShared++; });
+  sharedStates.visitBackwards(sharedWithHoleTrack.trackTip,
+                              [&](const auto& state) {
+                                nSharedWithHole++;
+                                firstWithHole = state.index();
+                              });
+  BOOST_CHECK_GT(firstWithHole, sharedTrack.trackTip);
+  BOOST_CHECK_EQUAL(nShared + nSharedWithHole, sharedStates.size());
+
+  // A failed fit leaves the shared trajectory untouched
+  size_t nSharedStates = sharedStates.size();
+  auto failedRes = kFitter.fit(std::vector<SourceLink>{}, rStart, kfOptions,
+                               &sharedStates);
+  BOOST_CHECK(!failedRes.ok());
+  BOOST_CHECK_EQUAL(sharedStates.size(), nSharedStates);
+
+  // Fit a batch of tracks concurrently
+  std::vector<std::vector<SourceLink>> batchSourcelinks = {
+      sourcelinks, shuffledMeasurements, measurementsWithHole,
+      measurementsWithOneOutlier};
+  std::vector<decltype(rStart)> batchStarts(batchSourcelinks.size(), rStart);
+  auto batchRes = kFitter.fitBatch(batchSourcelinks, batchStarts, kfOptions, 3);
+  BOOST_CHECK_EQUAL(batchRes.size(), batchSourcelinks.size());
+  // The results are in input order and identical to sequential fits
+  for (size_t it = 0; it < batchRes.size(); ++it) {
+    BOOST_CHECK(batchRes[it].ok());
+    auto serialRes = kFitter.fit(batchSourcelinks[it], rStart, kfOptions);
+    BOOST_CHECK(serialRes.ok());
+    auto& batchTrack = *batchRes[it];
+    auto& serialTrack = *serialRes;
+    BOOST_CHECK_EQUAL(batchTrack.fittedParameters.value().parameters(),
+                      serialTrack.fittedParameters.value().parameters());
+    BOOST_CHECK_EQUAL(batchTrack.processedStates, serialTrack.processedStates);
+    BOOST_CHECK_EQUAL(batchTrack.missedActiveSurfaces.size(),
+                      serialTrack.missedActiveSurfaces.size());
+  }
+  BOOST_CHECK_THROW(
+      kFitter.fitBatch(batchSourcelinks, std::vector<decltype(rStart)>{},
+                       kfOptions),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(source_link_lookup) {
+  // measurements on three surfaces, two of them on the same surface
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  std::vector<FittableMeasurement<SourceLink>> measurements;
+  for (size_t is = 0; is < 3; ++is) {
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        Vector3D(0., 0., 10. * is), Vector3D(0., 0., 1.)));
+  }
+  for (size_t is : {2, 0, 2, 1}) {
+    measurements.push_back(
+        MeasurementType<eLOC_0>(surfaces[is], {}, cov1D, 1. * is));
+  }
+  std::vector<SourceLink> sourcelinks;
+  for (const auto& m : measurements) {
+    sourcelinks.push_back(SourceLink{&m});
+  }
+
+  detail::SourceLinkLookup<SourceLink> lookup(sourcelinks);
+  BOOST_CHECK_EQUAL(lookup.size(), 3u);
+  // the first source link of a surface is kept
+  BOOST_CHECK_EQUAL(lookup.find(surfaces[2].get()), &sourcelinks[0]);
+  BOOST_CHECK_EQUAL(lookup.find(surfaces[0].get()), &sourcelinks[1]);
+  BOOST_CHECK_EQUAL(lookup.find(surfaces[1].get()), &sourcelinks[3]);
+  // all source links of a surface are found in the input order
+  auto candidates = lookup.findAll(surfaces[2].get());
+  BOOST_CHECK_EQUAL(candidates.size(), 2u);
+  BOOST_CHECK_EQUAL(candidates[0], &sourcelinks[0]);
+  BOOST_CHECK_EQUAL(candidates[1], &sourcelinks[2]);
+  BOOST_CHECK_EQUAL(lookup.findAll(surfaces[1].get()).size(), 1u);
+
+  // surfaces without source links
+  auto other = Surface::makeShared<PlaneSurface>(Vector3D(0., 0., 50.),
+                                                 Vector3D(0., 0., 1.));
+  BOOST_CHECK_EQUAL(lookup.find(other.get()), nullptr);
+  BOOST_CHECK(lookup.findAll(other.get()).empty());
+  BOOST_CHECK_EQUAL(detail::SourceLinkLookup<SourceLink>().find(other.get()),
+                    nullptr);
 }
 
 }  // namespace Test
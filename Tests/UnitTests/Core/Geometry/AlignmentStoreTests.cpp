@@ -0,0 +1,151 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <future>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Acts/Geometry/AlignedDetectorElement.hpp"
+#include "Acts/Geometry/AlignmentStore.hpp"
+#include "Acts/Geometry/detail/GeometryIDIndex.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(GeometryIDIndexTest) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<GeometryID::Value> volume(1, 10);
+  std::uniform_int_distribution<GeometryID::Value> layer(0, 20);
+  std::uniform_int_distribution<GeometryID::Value> approach(0, 2);
+  std::uniform_int_distribution<GeometryID::Value> sensitive(0, 300);
+  std::uniform_int_distribution<GeometryID::Value> sparse(0, 100000);
+
+  std::vector<GeometryID> ids;
+  for (size_t i = 0; i < 5000; ++i) {
+    GeometryID id;
+    id.setVolume(volume(rng)).setLayer(2 * layer(rng));
+    // mix of dense sensitive, approach and sparse sensitive numbers
+    if (i % 10 == 0) {
+      id.setApproach(approach(rng));
+    } else {
+      id.setSensitive((i % 10 == 1) ? sparse(rng) : sensitive(rng));
+    }
+    ids.push_back(id);
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  detail::GeometryIDIndex index(ids);
+  BOOST_CHECK_EQUAL(index.size(), ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    BOOST_CHECK_EQUAL(index.find(ids[i]), i);
+  }
+  // identifiers not in the list
+  for (size_t i = 0; i < 5000; ++i) {
+    GeometryID id;
+    id.setVolume(volume(rng) + 5).setLayer(layer(rng)).setSensitive(
+        sensitive(rng));
+    bool contained = std::binary_search(ids.begin(), ids.end(), id);
+    BOOST_CHECK_EQUAL(index.find(id) != detail::GeometryIDIndex::npos,
+                      contained);
+  }
+  BOOST_CHECK_EQUAL(detail::GeometryIDIndex().find(GeometryID()),
+                    detail::GeometryIDIndex::npos);
+}
+
+BOOST_AUTO_TEST_CASE(AlignmentStoreTest) {
+  std::vector<AlignmentStore::Entry> entries;
+  for (GeometryID::Value is = 10; is > 0; --is) {
+    Transform3D transform = Transform3D::Identity();
+    transform.translation() = Vector3D(0., 0., is);
+    entries.emplace_back(
+        GeometryID().setVolume(1).setLayer(2).setSensitive(is), transform);
+  }
+  AlignmentStore store(entries, 7);
+  BOOST_CHECK_EQUAL(store.version(), 7u);
+  BOOST_CHECK_EQUAL(store.size(), 10u);
+  BOOST_CHECK(std::is_sorted(store.ids().begin(), store.ids().end()));
+  for (GeometryID::Value is = 1; is <= 10; ++is) {
+    auto transform = store.transform(
+        GeometryID().setVolume(1).setLayer(2).setSensitive(is));
+    BOOST_CHECK_NE(transform, nullptr);
+    CHECK_CLOSE_ABS(transform->translation().z(), double(is), 1e-12);
+  }
+  BOOST_CHECK_EQUAL(
+      store.transform(GeometryID().setVolume(1).setLayer(2).setSensitive(11)),
+      nullptr);
+
+  // duplicates are rejected
+  entries.push_back(entries.front());
+  BOOST_CHECK_THROW(AlignmentStore{entries}, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(AlignedDetectorElementTest) {
+  auto nominal = std::make_shared<const Transform3D>(Transform3D::Identity());
+  AlignedDetectorElement element(
+      nominal, std::make_shared<const RectangleBounds>(1., 1.), 0.1);
+  const Surface& surface = element.surface();
+  GeometryID geoID = GeometryID().setVolume(2).setLayer(4).setSensitive(3);
+  const_cast<Surface&>(surface).assignGeoID(geoID);
+
+  // two alignment sets: shifted along z by their version
+  auto makeStore = [&](size_t version) {
+    Transform3D transform = Transform3D::Identity();
+    transform.translation() = Vector3D(0., 0., double(version));
+    return std::make_shared<const AlignmentStore>(
+        std::vector<AlignmentStore::Entry>{{geoID, transform}}, version);
+  };
+
+  // nominal without any store
+  GeometryContext nominalContext = GeometryContext();
+  CHECK_SMALL(surface.center(nominalContext).norm(), 1e-12);
+  GeometryContext emptyContext = AlignmentContext();
+  CHECK_SMALL(surface.center(emptyContext).norm(), 1e-12);
+
+  AlignmentProvider provider(makeStore(1));
+  GeometryContext first = provider.context();
+  provider.update(makeStore(2));
+  GeometryContext second = provider.context();
+  BOOST_CHECK_EQUAL(provider.store()->version(), 2u);
+
+  // the contexts keep their alignment set after the update
+  CHECK_CLOSE_ABS(surface.center(first).z(), 1., 1e-12);
+  CHECK_CLOSE_ABS(surface.center(second).z(), 2., 1e-12);
+
+  // concurrent use of the different alignment sets
+  auto sumZ = [&](const GeometryContext& gctx) {
+    double z = 0.;
+    for (size_t i = 0; i < 10000; ++i) {
+      z += surface.center(gctx).z();
+    }
+    return z;
+  };
+  auto firstZ = std::async(std::launch::async, sumZ, std::cref(first));
+  auto secondZ = std::async(std::launch::async, sumZ, std::cref(second));
+  CHECK_CLOSE_ABS(firstZ.get(), 10000., 1e-6);
+  CHECK_CLOSE_ABS(secondZ.get(), 20000., 1e-6);
+
+  // elements not in the store stay nominal
+  const_cast<Surface&>(surface).assignGeoID(
+      GeometryID().setVolume(2).setLayer(4).setSensitive(4));
+  CHECK_SMALL(surface.center(second).norm(), 1e-12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
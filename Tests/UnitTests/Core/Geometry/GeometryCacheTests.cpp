@@ -0,0 +1,188 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "Acts/Geometry/GeometryCache.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+/// A detector element that is shifted along z by the context payload
+class ShiftedDetectorElement : public DetectorElementBase {
+ public:
+  ShiftedDetectorElement(std::shared_ptr<const PlanarBounds> pBounds) {
+    m_shifted.translation() = Vector3D(0., 0., 1.);
+    m_surface = Surface::makeShared<PlaneSurface>(pBounds, *this);
+  }
+
+  const Transform3D& transform(const GeometryContext& gctx) const override {
+    return (std::any_cast<int>(gctx) == 1) ? m_shifted : m_nominal;
+  }
+
+  const Surface& surface() const override { return *m_surface; }
+
+  double thickness() const override { return 0.; }
+
+ private:
+  Transform3D m_nominal = Transform3D::Identity();
+  Transform3D m_shifted = Transform3D::Identity();
+  std::shared_ptr<const Surface> m_surface;
+};
+
+BOOST_AUTO_TEST_CASE(GeometryCacheTest) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  std::vector<const Surface*> surfaces;
+  tGeometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.push_back(surface); });
+  BOOST_CHECK(not surfaces.empty());
+
+  GeometryCache cache(tgContext, *tGeometry);
+  BOOST_CHECK_EQUAL(cache.size(), surfaces.size());
+
+  Vector3D position(10., -20., 30.);
+  for (const auto& surface : surfaces) {
+    BOOST_CHECK_NE(cache.slot(*surface), GeometryCache::npos);
+    const Transform3D* transform = cache.transform(*surface);
+    const Transform3D* inverse = cache.inverseTransform(*surface);
+    BOOST_REQUIRE(transform != nullptr and inverse != nullptr);
+    BOOST_CHECK(transform->isApprox(surface->transform(tgContext)));
+    CHECK_SMALL(((*transform) * (*inverse) * position - position).norm(),
+                1e-9);
+    // the columns hold the same transform
+    const auto& columns = cache.columns();
+    uint32_t islot = cache.slot(*surface);
+    Vector3D center(columns.cx[islot], columns.cy[islot], columns.cz[islot]);
+    Vector3D normal(columns.nx[islot], columns.ny[islot], columns.nz[islot]);
+    CHECK_CLOSE_ABS((center - surface->center(tgContext)).norm(), 0., 1e-12);
+    CHECK_CLOSE_ABS((normal - surface->normal(tgContext)).norm(), 0., 1e-12);
+  }
+
+  // a parallel evaluation gives the same cache
+  GeometryCache pcache(tgContext, *tGeometry, 4);
+  BOOST_CHECK_EQUAL(pcache.size(), cache.size());
+  for (const auto& surface : surfaces) {
+    BOOST_CHECK_EQUAL(pcache.slot(*surface), cache.slot(*surface));
+    BOOST_CHECK(
+        pcache.transform(*surface)->isApprox(*cache.transform(*surface)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GeometryCacheContextTest) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  // the context keeps its alignment payload, the cache is evaluated for it
+  // and only knows the surfaces of the tracking geometry
+  GeometryContext shifted = 1;
+  GeometryCache cache(shifted, *tGeometry);
+
+  ShiftedDetectorElement element(std::make_shared<RectangleBounds>(1., 1.));
+  const Surface& surface = element.surface();
+  BOOST_CHECK_EQUAL(cache.slot(surface), GeometryCache::npos);
+  BOOST_CHECK_EQUAL(cache.transform(surface), nullptr);
+  BOOST_CHECK_EQUAL(cache.inverseTransform(surface), nullptr);
+  CHECK_CLOSE_ABS(surface.center(shifted).z(), 1., 1e-12);
+  CHECK_CLOSE_ABS(surface.center(GeometryContext(0)).z(), 0., 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(GeometryCacheSurfacesTest) {
+  ShiftedDetectorElement element(std::make_shared<RectangleBounds>(1., 1.));
+  auto surface = Surface::makeShared<PlaneSurface>(
+      std::make_shared<RectangleBounds>(1., 1.), element);
+  surface->assignGeoID(GeometryID().setVolume(1).setLayer(2).setSensitive(3));
+
+  // surfaces without sensitive identifier are skipped
+  GeometryContext shifted = 1;
+  GeometryCache cache(shifted, {surface.get(), &element.surface()});
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+  BOOST_CHECK_EQUAL(cache.slot(element.surface()), GeometryCache::npos);
+  BOOST_REQUIRE_NE(cache.slot(*surface), GeometryCache::npos);
+  CHECK_CLOSE_ABS(cache.transform(*surface)->translation().z(), 1., 1e-12);
+
+  // the batch reads the placement from the cache if given, from the
+  // contextual transform otherwise
+  PlaneSurfaceBatch batch({surface.get()});
+  std::vector<size_t> slots = {batch.slot(surface.get())};
+  Vector3D position(0.5, 0.5, -1.);
+  Vector3D direction(0., 0., 1.);
+  std::vector<Intersection> intersections;
+  batch.intersect(GeometryContext(0), position, direction, true, slots,
+                  intersections);
+  BOOST_REQUIRE_EQUAL(intersections.size(), 1u);
+  CHECK_CLOSE_ABS(intersections[0].pathLength, 1., 1e-12);
+  batch.intersect(GeometryContext(0), position, direction, true, slots,
+                  intersections, &cache);
+  BOOST_REQUIRE_EQUAL(intersections.size(), 1u);
+  CHECK_CLOSE_ABS(intersections[0].pathLength, 2., 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(GeometryCacheBatchedIntersectionTest) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  GeometryCache cache(tgContext, *tGeometry);
+
+  // with & without the cached placements
+  const GeometryCache* geometryCaches[] = {nullptr, &cache};
+  for (const GeometryCache* geometryCache : geometryCaches) {
+    NavigationOptions<Surface> options(forward, true);
+    options.geometryCache = geometryCache;
+    size_t nSurfaces = 0;
+    tGeometry->visitSurfaces([&](const Surface* surface) {
+      ++nSurfaces;
+      BOOST_REQUIRE(surface->associatedDetectorElement() != nullptr);
+      // the detector element surfaces take the batched intersection
+      const Layer* layer = surface->associatedLayer();
+      BOOST_REQUIRE(layer != nullptr);
+      const PlaneSurfaceBatch& batch = layer->sensitiveBatch();
+      BOOST_CHECK_EQUAL(batch.size(), layer->surfaceArray()->surfaces().size());
+      BOOST_REQUIRE_NE(batch.slot(surface), PlaneSurfaceBatch::npos);
+      BOOST_CHECK(batch.supports(options.boundaryCheck));
+
+      // a straight line onto the module centre finds the module
+      Vector3D direction = surface->normal(tgContext);
+      Vector3D position = surface->center(tgContext) - 0.1 * direction;
+      auto sIntersections =
+          layer->compatibleSurfaces(tgContext, position, direction, options);
+      auto module =
+          std::find_if(sIntersections.begin(), sIntersections.end(),
+                       [&](const auto& sfi) { return sfi.object == surface; });
+      BOOST_REQUIRE(module != sIntersections.end());
+      CHECK_CLOSE_ABS(module->intersection.pathLength, 0.1, 1e-9);
+      // every candidate surface is found only once
+      for (const auto& sfi : sIntersections) {
+        BOOST_CHECK_EQUAL(
+            std::count_if(sIntersections.begin(), sIntersections.end(),
+                          [&](const auto& other) {
+                            return other.object == sfi.object;
+                          }),
+            1);
+      }
+    });
+    BOOST_CHECK_EQUAL(nSurfaces, cache.size());
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
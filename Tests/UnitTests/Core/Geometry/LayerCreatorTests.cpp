@@ -12,6 +12,7 @@
 
 #include <fstream>
 #include <random>
+#include <stdexcept>
 
 #include "Acts/Geometry/CylinderLayer.hpp"
 #include "Acts/Geometry/DiscLayer.hpp"
@@ -461,6 +462,54 @@ BOOST_FIXTURE_TEST_CASE(LayerCreator_barrelStagger, LayerCreatorFixture) {
   checkBinning(tgContext, *layer->surfaceArray());
 }
 
+BOOST_FIXTURE_TEST_CASE(LayerCreator_createLayers, LayerCreatorFixture) {
+  // disjoint surface sets for barrel layers of different sizes
+  std::vector<SrfVec> surfaceSets;
+  for (size_t il = 0; il < 8; ++il) {
+    surfaceSets.push_back(makeBarrel(12 + 2 * il, 3 + il, 2, 1.5));
+  }
+  LayerCreator::Config cfg;
+  cfg.surfaceArrayCreator = p_SAC;
+  LayerCreator layerCreator(
+      cfg, Acts::getDefaultLogger("LayerCreator", Acts::Logging::INFO));
+  auto createLayer = [&](size_t il) {
+    return layerCreator.cylinderLayer(tgContext, surfaceSets[il], equidistant,
+                                      equidistant);
+  };
+
+  auto sequential = layerCreator.createLayers(surfaceSets.size(), createLayer);
+  auto concurrent =
+      layerCreator.createLayers(surfaceSets.size(), createLayer, 4);
+  BOOST_CHECK_EQUAL(concurrent.size(), sequential.size());
+  for (size_t il = 0; il < sequential.size(); ++il) {
+    const auto& bSeq = dynamic_cast<const CylinderBounds&>(
+        sequential[il]->surfaceRepresentation().bounds());
+    const auto& bCon = dynamic_cast<const CylinderBounds&>(
+        concurrent[il]->surfaceRepresentation().bounds());
+    CHECK_CLOSE_REL(bCon.get(CylinderBounds::eR), bSeq.get(CylinderBounds::eR),
+                    1e-12);
+    CHECK_CLOSE_REL(bCon.get(CylinderBounds::eHalfLengthZ),
+                    bSeq.get(CylinderBounds::eHalfLengthZ), 1e-12);
+    const SurfaceArray* aSeq = sequential[il]->surfaceArray();
+    const SurfaceArray* aCon = concurrent[il]->surfaceArray();
+    BOOST_CHECK_EQUAL(aCon->size(), aSeq->size());
+    BOOST_CHECK(aCon->surfaces() == aSeq->surfaces());
+    BOOST_CHECK(checkBinning(tgContext, *aCon));
+  }
+
+  // exceptions of the factory are forwarded to the caller
+  BOOST_CHECK_THROW(layerCreator.createLayers(
+                        surfaceSets.size(),
+                        [&](size_t il) -> MutableLayerPtr {
+                          if (il == 5) {
+                            throw std::runtime_error("layer creation failed");
+                          }
+                          return createLayer(il);
+                        },
+                        4),
+                    std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 
@@ -179,5 +179,56 @@ BOOST_AUTO_TEST_CASE(TrackingGeometry_testVisitSurfaces) {
   BOOST_CHECK_EQUAL(nSurfaces, 9u);
 }
 
+BOOST_AUTO_TEST_CASE(TrackingGeometry_testFindByGeometryID) {
+  // every sensitive surface is found through its identifier
+  size_t nSurfaces = 0;
+  tGeometry.visitSurfaces([&](const Surface* surface) {
+    BOOST_CHECK_EQUAL(tGeometry.findSurface(surface->geoID()), surface);
+    BOOST_CHECK_NE(tGeometry.findLayer(GeometryID(surface->geoID())
+                                           .setSensitive(0)
+                                           .setApproach(0)),
+                   nullptr);
+    nSurfaces++;
+  });
+  BOOST_CHECK_EQUAL(nSurfaces, 9u);
+
+  // the indexed surfaces are sorted and identify themselves
+  const auto& surfaces = tGeometry.surfaces();
+  BOOST_CHECK_GT(surfaces.size(), nSurfaces);
+  for (size_t is = 0; is < surfaces.size(); ++is) {
+    BOOST_CHECK_EQUAL(tGeometry.findSurface(surfaces[is]->geoID()),
+                      surfaces[is]);
+    if (is > 0) {
+      BOOST_CHECK_LT(surfaces[is - 1]->geoID(), surfaces[is]->geoID());
+    }
+  }
+
+  // layers and their representing surfaces
+  auto world = tGeometry.highestTrackingVolume();
+  auto innerVolume = world->confinedVolumes()->arrayObjects()[0];
+  auto innerInner = innerVolume->confinedVolumes()->arrayObjects()[0];
+  for (const auto& layer : innerInner->confinedLayers()->arrayObjects()) {
+    BOOST_CHECK_EQUAL(tGeometry.findLayer(layer->geoID()), layer.get());
+    BOOST_CHECK_EQUAL(tGeometry.findSurface(layer->geoID()),
+                      &layer->surfaceRepresentation());
+  }
+
+  // volumes by identifier
+  for (GeometryID::Value iv = 1; iv <= 5; ++iv) {
+    auto volume = tGeometry.findVolume(GeometryID().setVolume(iv));
+    BOOST_CHECK_NE(volume, nullptr);
+    BOOST_CHECK_EQUAL(volume->geoID().volume(), iv);
+  }
+  BOOST_CHECK_EQUAL(world, tGeometry.findVolume(GeometryID().setVolume(1)));
+
+  // unknown identifiers
+  BOOST_CHECK_EQUAL(tGeometry.findVolume(GeometryID().setVolume(6)), nullptr);
+  BOOST_CHECK_EQUAL(tGeometry.findSurface(GeometryID().setVolume(3).setLayer(
+                        2).setSensitive(99)),
+                    nullptr);
+  BOOST_CHECK_EQUAL(tGeometry.findLayer(GeometryID().setVolume(3).setLayer(99)),
+                    nullptr);
+}
+
 }  //  end of namespace Test
 }  //  end of namespace Acts
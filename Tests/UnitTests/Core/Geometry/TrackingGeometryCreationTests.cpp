@@ -8,7 +8,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <random>
+
 #include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
 #include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
 
@@ -30,5 +33,34 @@ BOOST_AUTO_TEST_CASE(CubicTrackingGeometryTest) {
   BOOST_CHECK_NE(tGeometry, nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(LowestTrackingVolumeLookupTest) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  // reference: plain hierarchical search starting from the world
+  auto searchFromWorld = [&](const Vector3D& position) {
+    const TrackingVolume* searchVolume = tGeometry->highestTrackingVolume();
+    const TrackingVolume* currentVolume = nullptr;
+    while (currentVolume != searchVolume && searchVolume != nullptr) {
+      currentVolume = searchVolume;
+      searchVolume = searchVolume->lowestTrackingVolume(tgContext, position);
+    }
+    return currentVolume;
+  };
+
+  auto worldBox = tGeometry->highestTrackingVolume()->boundingBox();
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> unit(-0.1, 1.1);
+  for (size_t i = 0; i < 10000; ++i) {
+    Vector3D position;
+    for (size_t j = 0; j < 3; ++j) {
+      position[j] = worldBox.min()[j] +
+                    unit(rng) * (worldBox.max()[j] - worldBox.min()[j]);
+    }
+    BOOST_CHECK_EQUAL(tGeometry->lowestTrackingVolume(tgContext, position),
+                      searchFromWorld(position));
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
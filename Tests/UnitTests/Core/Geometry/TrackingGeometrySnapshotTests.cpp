@@ -0,0 +1,174 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+using Stepper = EigenStepper<ConstantBField>;
+using SnapshotPropagator = Propagator<Stepper, Navigator>;
+
+/// Propagate a fan of tracks and collect the sensitive and material surfaces
+std::vector<GeometryID> collect(
+    std::shared_ptr<const TrackingGeometry> tGeometry, double& materialInX0) {
+  ConstantBField bField(0., 0., 2_T);
+  Navigator navigator(std::move(tGeometry));
+  SnapshotPropagator propagator(Stepper(bField), std::move(navigator));
+
+  using ActionListType = ActionList<MaterialInteractor, SurfaceCollector<>>;
+  using AbortListType = AbortList<detail::EndOfWorldReached>;
+  PropagatorOptions<ActionListType, AbortListType> options(tgContext,
+                                                           mfContext);
+  auto& sCollector = options.actionList.get<SurfaceCollector<>>();
+  sCollector.selector.selectSensitive = true;
+  sCollector.selector.selectMaterial = true;
+
+  std::vector<GeometryID> collected;
+  materialInX0 = 0.;
+  for (size_t it = 0; it < 100; ++it) {
+    double phi = -M_PI + 2 * M_PI * (it + 0.5) / 100.;
+    double theta = 0.3 + 2.5 * (it % 10 + 0.5) / 10.;
+    Vector3D mom(std::cos(phi), std::sin(phi), 1. / std::tan(theta));
+    CurvilinearParameters start(std::nullopt, Vector3D(0., 0., 0.),
+                                2_GeV * mom, (it % 2) ? 1. : -1., 0.);
+    const auto& result = propagator.propagate(start, options).value();
+    for (const auto& cs :
+         result.get<SurfaceCollector<>::result_type>().collected) {
+      collected.push_back(cs.surface->geoID());
+    }
+    materialInX0 +=
+        result.get<MaterialInteractor::result_type>().materialInX0;
+  }
+  return collected;
+}
+
+/// Compare the identified surfaces of two tracking geometries
+void compareSurfaces(const TrackingGeometry& reference,
+                     const TrackingGeometry& restored) {
+  BOOST_REQUIRE_EQUAL(reference.surfaces().size(),
+                      restored.surfaces().size());
+  for (size_t is = 0; is < reference.surfaces().size(); ++is) {
+    const Surface* rs = reference.surfaces()[is];
+    const Surface* ts = restored.surfaces()[is];
+    BOOST_CHECK_EQUAL(rs->geoID(), ts->geoID());
+    BOOST_CHECK_EQUAL(rs->type(), ts->type());
+    BOOST_CHECK_EQUAL(rs->bounds().type(), ts->bounds().type());
+    BOOST_CHECK(rs->bounds().values() == ts->bounds().values());
+    CHECK_SMALL((rs->center(tgContext) - ts->center(tgContext)).norm(), 1e-9);
+    BOOST_CHECK_EQUAL(rs->surfaceMaterial() != nullptr,
+                      ts->surfaceMaterial() != nullptr);
+    if (rs->surfaceMaterial() != nullptr and
+        ts->surfaceMaterial() != nullptr) {
+      CHECK_CLOSE_ABS(
+          rs->surfaceMaterial()->materialProperties(0, 0).thickness(),
+          ts->surfaceMaterial()->materialProperties(0, 0).thickness(), 1e-6);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_roundtrip) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  std::shared_ptr<const TrackingGeometry> tGeometry = cGeometry();
+
+  double referenceX0 = 0.;
+  auto reference = collect(tGeometry, referenceX0);
+  BOOST_CHECK(not reference.empty());
+
+  TrackingGeometrySnapshot::Config cfg;
+  TrackingGeometrySnapshot snapshot(cfg);
+  auto buffer = snapshot.write(tgContext, *tGeometry);
+  BOOST_CHECK(not buffer.empty());
+
+  // Restore without detector elements: free surfaces
+  std::shared_ptr<const TrackingGeometry> freeGeometry =
+      snapshot.read(tgContext, buffer.data(), buffer.size());
+  BOOST_CHECK_EQUAL(freeGeometry->highestTrackingVolume()->volumeName(),
+                    tGeometry->highestTrackingVolume()->volumeName());
+  compareSurfaces(*tGeometry, *freeGeometry);
+
+  double freeX0 = 0.;
+  auto freeCollected = collect(freeGeometry, freeX0);
+  BOOST_CHECK(freeCollected == reference);
+  CHECK_CLOSE_REL(freeX0, referenceX0, 1e-6);
+
+  // Restore with the detector elements of the sensitive surfaces
+  std::map<GeometryID, const DetectorElementBase*> elements;
+  for (const auto& element : cGeometry.detectorStore) {
+    elements[element->surface().geoID()] = element.get();
+  }
+  cfg.detectorElementResolver = [&](const GeometryID& geoID) {
+    auto search = elements.find(geoID);
+    return search != elements.end() ? search->second : nullptr;
+  };
+  TrackingGeometrySnapshot resolvingSnapshot(cfg);
+  std::shared_ptr<const TrackingGeometry> elementGeometry =
+      resolvingSnapshot.read(tgContext, buffer.data(), buffer.size());
+  compareSurfaces(*tGeometry, *elementGeometry);
+  for (const auto& element : cGeometry.detectorStore) {
+    GeometryID geoID = element->surface().geoID();
+    BOOST_CHECK_EQUAL(elementGeometry->findSurface(geoID), &element->surface());
+  }
+
+  double elementX0 = 0.;
+  auto elementCollected = collect(elementGeometry, elementX0);
+  BOOST_CHECK(elementCollected == reference);
+  CHECK_CLOSE_REL(elementX0, referenceX0, 1e-6);
+
+  // A snapshot of the restored geometry is identical
+  BOOST_CHECK(snapshot.write(tgContext, *elementGeometry) == buffer);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_corrupt) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  TrackingGeometrySnapshot snapshot(TrackingGeometrySnapshot::Config{});
+  auto buffer = snapshot.write(tgContext, *tGeometry);
+
+  // Truncated snapshots are rejected
+  BOOST_CHECK_THROW(snapshot.read(tgContext, buffer.data(), 16),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(
+      snapshot.read(tgContext, buffer.data(), buffer.size() / 2),
+      std::invalid_argument);
+
+  // Foreign data is rejected
+  auto foreign = buffer;
+  foreign[0] = 'X';
+  BOOST_CHECK_THROW(snapshot.read(tgContext, foreign.data(), foreign.size()),
+                    std::invalid_argument);
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -113,6 +113,150 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(not c.isInside((pos << 0, 2, -4.7).finished()));
   BOOST_CHECK(not c.isInside((pos << 5, 2, 14.).finished()));
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_gradient) {
+  // definition of dummy BField, linear in each coordinate so that the
+  // interpolation and its gradient are exact
+  struct BField {
+    static Vector3D value(const std::array<double, 3>& xyz) {
+      double x = xyz.at(0);
+      double y = xyz.at(1);
+      double z = xyz.at(2);
+      return Vector3D(2 * x - y, 3 * z, x * y - 4 * z);
+    }
+    static ActsMatrixD<3, 3> gradient(const Vector3D& pos) {
+      ActsMatrixD<3, 3> grad;
+      grad << 2, -1, 0, 0, 0, 3, pos.y(), pos.x(), -4;
+      return grad;
+    }
+  };
+
+  auto transformPos = [](const Vector3D& pos) { return pos; };
+  auto transformBField = [](const Vector3D& field, const Vector3D&) {
+    return field;
+  };
+
+  detail::EquidistantAxis x(-4.0, 4.0, 8u);
+  detail::EquidistantAxis y(-4.0, 4.0, 8u);
+  detail::EquidistantAxis z(-4.0, 4.0, 4u);
+
+  using Grid_t = detail::Grid<Vector3D, detail::EquidistantAxis,
+                              detail::EquidistantAxis, detail::EquidistantAxis>;
+  using Mapper_t = InterpolatedBFieldMapper<Grid_t>;
+  using BField_t = InterpolatedBFieldMap<Mapper_t>;
+
+  Grid_t g(std::make_tuple(std::move(x), std::move(y), std::move(z)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        const auto& llCorner = g.lowerLeftBinEdge(indices);
+        g.atLocalBins(indices) = BField::value(llCorner);
+      }
+    }
+  }
+
+  Mapper_t mapper(transformPos, transformBField, std::move(g));
+  BField_t b(BField_t::Config(std::move(mapper)));
+  BField_t::Cache bCache(mfContext);
+
+  // x*y term is bilinear within each cell, the gradient is exact there
+  std::vector<Vector3D> positions = {Vector3D(-3.3, 2.5, 1.7),
+                                     Vector3D(0.2, -0.9, 3.1),
+                                     Vector3D(1.5, 1.5, -2.5)};
+  for (const auto& pos : positions) {
+    ActsMatrixD<3, 3> gradient = ActsMatrixD<3, 3>::Zero();
+    Vector3D field = b.getFieldGradient(pos, gradient);
+    CHECK_CLOSE_REL(field, b.getField(pos), 1e-6);
+    CHECK_SMALL((gradient - BField::gradient(pos)).norm(), 1e-6);
+
+    ActsMatrixD<3, 3> cachedGradient = ActsMatrixD<3, 3>::Zero();
+    Vector3D cachedField = b.getFieldGradient(pos, cachedGradient, bCache);
+    CHECK_CLOSE_REL(cachedField, field, 1e-6);
+    CHECK_SMALL((cachedGradient - gradient).norm(), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz_gradient) {
+  // (Br,Bz) field map, rotated into the global frame
+  struct BField {
+    static Vector2D value(const std::array<double, 2>& rz) {
+      double r = rz.at(0);
+      double z = rz.at(1);
+      return Vector2D(0.5 + 0.2 * r * z, 2 - 0.3 * r + 0.1 * z);
+    }
+  };
+
+  // map (x,y,z) -> (r,z)
+  auto transformPos = [](const Vector3D& pos) {
+    return ActsVectorD<2>(perp(pos), pos.z());
+  };
+
+  // map (Br,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Vector2D& field, const Vector3D& pos) {
+    double r = perp(pos);
+    return Vector3D(field.x() * pos.x() / r, field.x() * pos.y() / r,
+                    field.y());
+  };
+
+  detail::EquidistantAxis r(0.0, 4.0, 4u);
+  detail::EquidistantAxis z(-5, 5, 5u);
+
+  using Grid_t =
+      detail::Grid<Vector2D, detail::EquidistantAxis, detail::EquidistantAxis>;
+  using Mapper_t = InterpolatedBFieldMapper<Grid_t>;
+  using BField_t = InterpolatedBFieldMap<Mapper_t>;
+
+  Grid_t g(std::make_tuple(std::move(r), std::move(z)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto& llCorner = g.lowerLeftBinEdge(indices);
+      g.atLocalBins(indices) = BField::value(llCorner);
+    }
+  }
+
+  Mapper_t mapper(transformPos, transformBField, std::move(g));
+  BField_t b(BField_t::Config(std::move(mapper)));
+
+  // compare with finite differences of the field, away from the axis and
+  // the cell boundaries
+  constexpr double h = 1e-5;
+  std::vector<Vector3D> positions = {Vector3D(1.1, 0.7, 0.3),
+                                     Vector3D(-0.8, 2.4, -3.3),
+                                     Vector3D(-1.3, -1.6, 2.7)};
+  for (const auto& pos : positions) {
+    ActsMatrixD<3, 3> gradient = ActsMatrixD<3, 3>::Zero();
+    Vector3D field = b.getFieldGradient(pos, gradient);
+    CHECK_CLOSE_REL(field, b.getField(pos), 1e-9);
+
+    ActsMatrixD<3, 3> expected;
+    for (size_t j = 0; j < 3; ++j) {
+      Vector3D step = Vector3D::Zero();
+      step[j] = h;
+      expected.col(j) =
+          (b.getField(pos + step) - b.getField(pos - step)) / (2 * h);
+    }
+    // the rotation of the field contributes off-axis
+    BOOST_CHECK_GT(std::abs(expected(0, 1)), 1e-2);
+    CHECK_SMALL((gradient - expected).norm(), 1e-6);
+  }
+
+  // the cached gradient reuses the grid cell while the position stays inside
+  BField_t::Cache bCache(mfContext);
+  for (const auto& pos : {Vector3D(1.1, 0.7, 0.3), Vector3D(0.7, 1.1, 0.6),
+                          Vector3D(-2.6, 0.4, 0.3)}) {
+    ActsMatrixD<3, 3> gradient = ActsMatrixD<3, 3>::Zero();
+    Vector3D field = b.getFieldGradient(pos, gradient);
+    ActsMatrixD<3, 3> cachedGradient = ActsMatrixD<3, 3>::Zero();
+    Vector3D cachedField = b.getFieldGradient(pos, cachedGradient, bCache);
+    CHECK_CLOSE_REL(cachedField, field, 1e-12);
+    CHECK_SMALL((cachedGradient - gradient).norm(), 1e-12);
+    BOOST_REQUIRE(bCache.gradientCell);
+    BOOST_CHECK(
+        (*bCache.gradientCell).isInside(ActsVectorD<2>(perp(pos), pos.z())));
+  }
+}
 }  // namespace Test
 
 }  // namespace Acts
@@ -10,6 +10,9 @@
 #include <boost/test/tools/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <random>
+#include <vector>
+
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
@@ -124,6 +127,51 @@ BOOST_AUTO_TEST_CASE(BoundaryCheckTriangleCovariance) {
   BOOST_CHECK(check.isInside({0, 4}, vertices));
   BOOST_CHECK(!check.isInside({0, 5}, vertices));
 }
+
+// Precomputed edges give the same result as the vertices
+BOOST_AUTO_TEST_CASE(BoundaryCheckPolygonEdges) {
+  // clockwise trapezoid and counter-clockwise hexagon
+  std::vector<std::vector<Vector2D>> polygons = {
+      {{-0.2, 0.75}, {0.2, 0.75}, {0.4, 0.25}, {-0.4, 0.25}},
+      {{-1., -2.}, {1., -2.}, {2., 0.}, {1.5, 1.}, {-1.5, 1.}, {-2., 0.}}};
+  ActsSymMatrixD<2> cov;
+  cov << 0.2, 0.02, 0.02, 0.15;
+  std::vector<BoundaryCheck> checks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, false, 0.3, 0.), BoundaryCheck(true, true, 0.6, 0.45),
+      BoundaryCheck(cov, 3.0)};
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> axis(-3., 3.);
+  std::vector<Vector2D> points(2000);
+  for (auto& point : points) {
+    point = Vector2D(axis(rng), axis(rng));
+  }
+  // points on the vertices and the edges
+  for (const auto& polygon : polygons) {
+    for (size_t iv = 0; iv < polygon.size(); ++iv) {
+      points.push_back(polygon[iv]);
+      points.push_back(0.5 * (polygon[iv] + polygon[(iv + 1) % polygon.size()]));
+    }
+  }
+
+  for (const auto& polygon : polygons) {
+    detail::PolygonEdges edges(polygon);
+    BOOST_CHECK_EQUAL(edges.size(), polygon.size());
+    for (const auto& check : checks) {
+      std::vector<bool> inside;
+      check.isInside(points, edges, inside);
+      BOOST_CHECK_EQUAL(inside.size(), points.size());
+      for (size_t ip = 0; ip < points.size(); ++ip) {
+        bool expected = check.isInside(points[ip], polygon);
+        BOOST_CHECK_EQUAL(check.isInside(points[ip], edges), expected);
+        BOOST_CHECK_EQUAL(inside[ip], expected);
+        CHECK_CLOSE_ABS(check.distance(points[ip], edges),
+                        check.distance(points[ip], polygon), 1e-9);
+      }
+    }
+  }
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 }  // namespace Acts
@@ -24,6 +24,7 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <algorithm>
 #include <fstream>
 
 using Acts::VectorHelpers::perp;
@@ -219,10 +220,26 @@ BOOST_FIXTURE_TEST_CASE(SurfaceArray_create, SurfaceArrayFixture) {
     BOOST_CHECK_EQUAL(srf.get(), binContent.at(0));
   }
 
-  std::vector<const Surface*> neighbors =
-      sa.neighbors(itransform(Vector2D(0, 0)));
+  SurfaceVector neighbors(sa.neighbors(itransform(Vector2D(0, 0))));
   BOOST_CHECK_EQUAL(neighbors.size(), 9u);
 
+  // views are neither bound to vectors nor copied into them implicitly
+  static_assert(not std::is_convertible_v<SurfaceVector, SurfaceRange>,
+                "Implicit conversion of a vector to a surface range");
+  static_assert(not std::is_convertible_v<SurfaceRange, SurfaceVector>,
+                "Implicit conversion of a surface range to a vector");
+
+  // the neighbors are a view into the contiguous storage of the lookup,
+  // they contain the bin content and are not copied on lookup
+  for (const auto& srf : brl) {
+    Vector3D ctr = srf->binningPosition(tgContext, binR);
+    SurfaceRange range = sa.neighbors(ctr);
+    BOOST_CHECK_GE(range.size(), 6u);
+    BOOST_CHECK(std::find(range.begin(), range.end(), srf.get()) !=
+                range.end());
+    BOOST_CHECK_EQUAL(sa.neighbors(ctr).begin(), range.begin());
+  }
+
   auto sl2 = std::make_unique<
       SurfaceArray::SurfaceGridLookup<decltype(phiAxis), decltype(zAxis)>>(
       transform, itransform,
@@ -10,12 +10,16 @@
 #include <boost/test/tools/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <random>
+
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/ConeSurface.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -313,6 +317,89 @@ BOOST_AUTO_TEST_CASE(PlanarIntersectionTest) {
   testPlanarIntersection(aTransform);
 }
 
+/// This tests the batched intersection with planar surfaces against the
+/// intersection of the individual surfaces
+BOOST_AUTO_TEST_CASE(PlanarBatchIntersectionTest) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+  std::uniform_real_distribution<double> offset(-20_cm, 20_cm);
+
+  auto rBounds = std::make_shared<RectangleBounds>(5_cm, 10_cm);
+  auto sBounds = std::make_shared<RectangleBounds>(Vector2D(-2_cm, 1_cm),
+                                                   Vector2D(6_cm, 3_cm));
+  auto tBounds = std::make_shared<TrapezoidBounds>(3_cm, 7_cm, 10_cm);
+
+  // A ring of tilted planes with the different bounds
+  std::vector<std::shared_ptr<const Surface>> planes;
+  std::vector<const Surface*> surfaces;
+  for (size_t ip = 0; ip < 30; ++ip) {
+    double phi = ip * 2 * M_PI / 30;
+    Transform3D transform = Transform3D::Identity() *
+                            Translation3D(20_cm * std::cos(phi),
+                                          20_cm * std::sin(phi), offset(rng)) *
+                            AngleAxis3D(phi + 0.1, Vector3D(0., 0., 1.)) *
+                            AngleAxis3D(0.5 * M_PI, Vector3D(0., 1., 0.));
+    auto pTransform = std::make_shared<Transform3D>(transform);
+    std::shared_ptr<const PlanarBounds> bounds =
+        (ip % 3 == 0) ? std::static_pointer_cast<const PlanarBounds>(rBounds)
+                      : (ip % 3 == 1)
+                            ? std::static_pointer_cast<const PlanarBounds>(
+                                  sBounds)
+                            : std::static_pointer_cast<const PlanarBounds>(
+                                  tBounds);
+    planes.push_back(Surface::makeShared<PlaneSurface>(pTransform, bounds));
+    surfaces.push_back(planes.back().get());
+  }
+  // A cylinder is not batched
+  auto aCylinder = Surface::makeShared<CylinderSurface>(
+      std::make_shared<Transform3D>(Transform3D::Identity()), 1_m, 1_m);
+  surfaces.push_back(aCylinder.get());
+
+  PlaneSurfaceBatch batch(surfaces);
+  BOOST_CHECK_EQUAL(batch.size(), 30u);
+  BOOST_CHECK_EQUAL(batch.slot(aCylinder.get()), PlaneSurfaceBatch::npos);
+
+  std::vector<size_t> slots;
+  for (size_t is = 0; is < 30; ++is) {
+    slots.push_back(batch.slot(surfaces[is]));
+    BOOST_CHECK_EQUAL(&batch.surface(slots.back()), surfaces[is]);
+  }
+
+  BoundaryCheck tolerance(true, true, 1_cm, 1_cm);
+  BOOST_CHECK(batch.supports(true));
+  BOOST_CHECK(batch.supports(false));
+  BOOST_CHECK(not batch.supports(tolerance));
+
+  std::vector<Intersection> intersections;
+  size_t nValid = 0;
+  for (size_t it = 0; it < 1000; ++it) {
+    Vector3D position(0., 0., offset(rng));
+    double phi = angle(rng);
+    double theta = 0.5 * M_PI + 0.2 * angle(rng);
+    Vector3D direction(std::cos(phi) * std::sin(theta),
+                       std::sin(phi) * std::sin(theta), std::cos(theta));
+    for (bool bcheck : {true, false}) {
+      batch.intersect(tgContext, position, direction, bcheck, slots,
+                      intersections);
+      BOOST_CHECK_EQUAL(intersections.size(), slots.size());
+      for (size_t is = 0; is < slots.size(); ++is) {
+        auto reference = surfaces[is]->intersectionEstimate(
+            tgContext, position, direction, bcheck);
+        BOOST_CHECK_EQUAL(bool(intersections[is]), bool(reference));
+        if (reference) {
+          ++nValid;
+          BOOST_CHECK(intersections[is].status == reference.status);
+          CHECK_CLOSE_ABS(intersections[is].pathLength, reference.pathLength,
+                          1e-9);
+          CHECK_SMALL((intersections[is].position - reference.position).norm(),
+                      1e-9);
+        }
+      }
+    }
+  }
+  BOOST_CHECK_GT(nValid, 1000u);
+}
+
 /// This tests the interseciton with line like surfaces (straw, perigee)
 /// as those share the same methods, only one test is
 /// sufficient
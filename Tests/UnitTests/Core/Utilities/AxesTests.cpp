@@ -8,6 +8,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <vector>
+
 #include "Acts/Utilities/detail/Axis.hpp"
 
 namespace Acts {
@@ -369,6 +372,45 @@ BOOST_AUTO_TEST_CASE(wrapBin) {
   BOOST_CHECK_EQUAL(a6.wrapBin(7), 2u);
 }
 
+BOOST_AUTO_TEST_CASE(equidistant_getBins) {
+  Axis<AxisType::Equidistant, AxisBoundaryType::Open> a1(0.0, 10.0, 10u);
+  Axis<AxisType::Equidistant, AxisBoundaryType::Bound> a2(0.0, 10.0, 10u);
+  Axis<AxisType::Equidistant, AxisBoundaryType::Closed> a3(0.0, 10.0, 10u);
+
+  // far outside the range
+  BOOST_CHECK_EQUAL(a1.getBin(-1e30), 0u);
+  BOOST_CHECK_EQUAL(a1.getBin(1e30), 11u);
+  BOOST_CHECK_EQUAL(a1.getBin(std::nan("")), 0u);
+  BOOST_CHECK_EQUAL(a2.getBin(-1e30), 1u);
+  BOOST_CHECK_EQUAL(a2.getBin(1e30), 10u);
+  BOOST_CHECK_EQUAL(a3.getBin(-25.5), 5u);
+  BOOST_CHECK_EQUAL(a3.getBin(-10.5), 10u);
+  BOOST_CHECK_EQUAL(a3.getBin(-10.), 1u);
+  BOOST_CHECK_EQUAL(a3.getBin(20.), 1u);
+  BOOST_CHECK_EQUAL(a3.getBin(34.5), 5u);
+
+  // batch lookup is identical to the single lookup
+  std::vector<double> x;
+  for (double v = -25.25; v < 35.; v += 0.5) {
+    x.push_back(v);
+  }
+  std::vector<size_t> bins = {42u};
+  a1.getBins(x, bins);
+  BOOST_CHECK_EQUAL(bins.size(), x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    BOOST_CHECK_EQUAL(bins[i], a1.getBin(x[i]));
+  }
+  a2.getBins(x, bins);
+  for (size_t i = 0; i < x.size(); ++i) {
+    BOOST_CHECK_EQUAL(bins[i], a2.getBin(x[i]));
+  }
+  a3.getBins(x, bins);
+  for (size_t i = 0; i < x.size(); ++i) {
+    BOOST_CHECK_EQUAL(bins[i], a3.getBin(x[i]));
+    BOOST_CHECK_EQUAL(bins[i], a3.wrapBin(std::floor(x[i]) + 1));
+  }
+}
+
 }  // namespace Test
 
 }  // namespace Acts
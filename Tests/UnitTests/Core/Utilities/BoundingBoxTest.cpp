@@ -20,6 +20,7 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/BoundingBox.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/FlatBoundingBoxHierarchy.hpp"
 #include "Acts/Utilities/Frustum.hpp"
 #include "Acts/Utilities/Ray.hpp"
 #include "Acts/Visualization/PlyHelper.hpp"
@@ -1190,5 +1191,86 @@ BOOST_AUTO_TEST_CASE(frustum_intersect) {
     os.close();
   }
 }
+BOOST_AUTO_TEST_CASE(sah_tree) {
+  using Box = AxisAlignedBoundingBox<Object, double, 3>;
+  using vec3 = ActsVectorD<3>;
+
+  // modules on an elongated barrel
+  size_t n = 2000;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> zDist(-1000, 1000);
+  std::vector<Object> objects(n);
+  std::vector<std::unique_ptr<Box>> prims_store;
+  std::vector<Box*> prims;
+  for (size_t i = 0; i < n; ++i) {
+    double phi = phiDist(rng);
+    vec3 ctr(100 * std::cos(phi), 100 * std::sin(phi), zDist(rng));
+    prims_store.push_back(
+        std::make_unique<Box>(&objects[i], ctr, Box::Size(vec3(3, 3, 6))));
+    prims.push_back(prims_store.back().get());
+  }
+
+  std::vector<std::unique_ptr<Box>> store;
+  const Box* top = make_sah_tree(store, prims, 4);
+
+  auto stats = hierarchy_stats(top);
+  BOOST_CHECK_EQUAL(stats.leaves, n);
+  BOOST_CHECK_EQUAL(stats.nodes, n + store.size());
+  BOOST_CHECK_GT(stats.depth, 1u);
+  BOOST_CHECK_GT(stats.expectedCost, 1.);
+
+  // the traversal finds exactly the boxes which are intersected
+  std::uniform_real_distribution<double> dirDist(-1, 1);
+  for (size_t i = 0; i < 100; ++i) {
+    vec3 dir = vec3(dirDist(rng), dirDist(rng), dirDist(rng)).normalized();
+    Ray<double, 3> ray({0, 0, 0}, dir);
+    std::set<const Object*> expected;
+    for (const auto* box : prims) {
+      if (box->intersect(ray)) {
+        expected.insert(box->entity());
+      }
+    }
+    std::set<const Object*> found;
+    const Box* lnode = top;
+    do {
+      if (lnode->intersect(ray)) {
+        if (lnode->hasEntity()) {
+          found.insert(lnode->entity());
+          lnode = lnode->getSkip();
+        } else {
+          lnode = lnode->getLeftChild();
+        }
+      } else {
+        lnode = lnode->getSkip();
+      }
+    } while (lnode != nullptr);
+    BOOST_CHECK(found == expected);
+  }
+
+  // the parallel build gives the identical tree, the primitives are relinked
+  // by every build, so the first tree has to be copied before
+  FlatBoundingBoxHierarchy<Box> flat(top);
+  std::vector<std::unique_ptr<Box>> store_mt;
+  const Box* top_mt = make_sah_tree(store_mt, prims, 4, 0., 4);
+  FlatBoundingBoxHierarchy<Box> flat_mt(top_mt);
+  BOOST_CHECK_EQUAL(store_mt.size(), store.size());
+  BOOST_REQUIRE_EQUAL(flat_mt.size(), flat.size());
+  for (size_t i = 0; i < flat.size(); ++i) {
+    BOOST_CHECK(flat.nodes()[i].vmin == flat_mt.nodes()[i].vmin);
+    BOOST_CHECK(flat.nodes()[i].vmax == flat_mt.nodes()[i].vmax);
+    BOOST_CHECK_EQUAL(flat.nodes()[i].skip, flat_mt.nodes()[i].skip);
+  }
+
+  std::vector<std::unique_ptr<Box>> store_oct;
+  const Box* top_oct = make_octree(store_oct, prims, 4);
+  auto stats_oct = hierarchy_stats(top_oct);
+  BOOST_CHECK_EQUAL(stats_oct.leaves, n);
+  BOOST_TEST_MESSAGE("SAH tree: depth " << stats.depth << ", expected cost "
+                                        << stats.expectedCost);
+  BOOST_TEST_MESSAGE("Octree: depth " << stats_oct.depth << ", expected cost "
+                                      << stats_oct.expectedCost);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,102 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2019 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Acts/Utilities/BoundingBox.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/FlatBoundingBoxHierarchy.hpp"
+#include "Acts/Utilities/Frustum.hpp"
+#include "Acts/Utilities/Ray.hpp"
+
+namespace Acts {
+namespace Test {
+
+struct Object {};
+
+using Box = AxisAlignedBoundingBox<Object, double, 3>;
+using FlatHierarchy = FlatBoundingBoxHierarchy<Box>;
+using vec3 = ActsVectorD<3>;
+
+// reference traversal of the linked hierarchy
+template <typename object_t>
+std::vector<const Object*> linkedIntersect(const object_t& obj,
+                                           const Box* lnode) {
+  std::vector<const Object*> hits;
+  do {
+    if (lnode->intersect(obj)) {
+      if (lnode->hasEntity()) {
+        hits.push_back(lnode->entity());
+        lnode = lnode->getSkip();
+      } else {
+        lnode = lnode->getLeftChild();
+      }
+    } else {
+      lnode = lnode->getSkip();
+    }
+  } while (lnode != nullptr);
+  return hits;
+}
+
+BOOST_AUTO_TEST_CASE(flat_hierarchy_empty) {
+  FlatHierarchy flat(nullptr);
+  BOOST_CHECK(flat.empty());
+  BOOST_CHECK(flat.intersect(Ray<double, 3>({0, 0, 0}, {1, 0, 0})).empty());
+}
+
+BOOST_AUTO_TEST_CASE(flat_hierarchy_single_box) {
+  Object o;
+  Box box(&o, {-1, -1, -1}, {1, 1, 1});
+  FlatHierarchy flat(&box);
+  BOOST_CHECK_EQUAL(flat.size(), 1u);
+  auto hits = flat.intersect(Ray<double, 3>({-5, 0, 0}, {1, 0, 0}));
+  BOOST_CHECK_EQUAL(hits.size(), 1u);
+  BOOST_CHECK_EQUAL(hits.front(), &o);
+  BOOST_CHECK(flat.intersect(Ray<double, 3>({-5, 0, 0}, {-1, 0, 0})).empty());
+}
+
+BOOST_AUTO_TEST_CASE(flat_hierarchy_octree) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> pos(-100, 100);
+  std::uniform_real_distribution<double> dir(-1, 1);
+
+  // a cloud of small boxes
+  size_t n = 500;
+  std::vector<Object> objects(n);
+  std::vector<std::unique_ptr<Box>> store;
+  std::vector<Box*> prims;
+  for (size_t i = 0; i < n; ++i) {
+    vec3 ctr(pos(rng), pos(rng), pos(rng));
+    store.push_back(
+        std::make_unique<Box>(&objects[i], ctr, Box::Size(vec3(4, 4, 4))));
+    prims.push_back(store.back().get());
+  }
+  const Box* top = make_octree(store, prims, 4);
+
+  FlatHierarchy flat(top);
+  BOOST_CHECK_EQUAL(flat.size(), store.size());
+  BOOST_CHECK_EQUAL(flat.nodes().front().skip, flat.size());
+
+  for (size_t i = 0; i < 200; ++i) {
+    vec3 origin(pos(rng), pos(rng), pos(rng));
+    vec3 direction = vec3(dir(rng), dir(rng), dir(rng)).normalized();
+
+    Ray<double, 3> ray(origin, direction);
+    BOOST_CHECK(flat.intersect(ray) == linkedIntersect(ray, top));
+
+    Frustum<double, 3, 4> fr(origin, direction, M_PI / 8.);
+    BOOST_CHECK(flat.intersect(fr) == linkedIntersect(fr, top));
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
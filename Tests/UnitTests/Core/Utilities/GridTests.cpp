@@ -1120,6 +1120,12 @@ BOOST_AUTO_TEST_CASE(neighborhood) {
               bins_t({24, 25, 26, 22, 23, 31, 32, 33, 29, 30, 38, 39, 40,
                       36, 37, 10, 11, 12, 8,  9,  17, 18, 19, 15, 16}));
 
+  // collecting into a container of fixed capacity gives the same sequence
+  auto staticBins = g2Cl.neighborHoodIndices({{1, 5}}, 1).collect<9>();
+  BOOST_CHECK_EQUAL(staticBins.capacity(), 9u);
+  BOOST_CHECK(bins_t(staticBins.begin(), staticBins.end()) ==
+              bins_t({39, 40, 36, 11, 12, 8, 18, 19, 15}));
+
   // @TODO 3D test would be nice, but should essentially not be a problem if
   // 2D works.
 
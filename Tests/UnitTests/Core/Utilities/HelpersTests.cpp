@@ -33,6 +33,21 @@ BOOST_AUTO_TEST_CASE(bitset_to_matrix_to_bitset) {
   cnv = bitsetToMatrix<decltype(cnv)>(act);
 
   BOOST_CHECK_EQUAL(mat, cnv);
+
+  // first and last element, as for a projector
+  Eigen::Matrix<double, 2, 6> proj;
+  proj.setZero();
+  proj(0, 0) = 1;
+  proj(1, 5) = 1;
+  BOOST_CHECK_EQUAL(proj, bitsetToMatrix<decltype(proj)>(matrixToBitset(proj)));
+
+  // more bits than in a single word
+  Eigen::Matrix<int, 9, 9> big;
+  big.setZero();
+  big(0, 0) = 1;
+  big(4, 7) = 1;
+  big(8, 8) = 1;
+  BOOST_CHECK_EQUAL(big, bitsetToMatrix<decltype(big)>(matrixToBitset(big)));
 }
 
 struct MyStruct {